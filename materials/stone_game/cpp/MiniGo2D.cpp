@@ -0,0 +1,45 @@
+#include "MiniGo2D.h"
+#include "Symmetry2D.h"
+#include <algorithm>
+
+MiniGo2D::MiniGo2D(int tt_bits) : StoneSearch(tt_bits) {}
+
+void MiniGo2D::set_board_size(int n) {
+    n = std::max(1, std::min(n, MAX_N));
+    if (n == n_size) return;
+    n_size = n;
+    uint64_t mask = 0;
+    for (int r = 0; r < n; ++r) {
+        mask |= ((1ULL << n) - 1) << (r * STRIDE);
+    }
+    // 列 N 以上は番兵なので、左右のシフトで隣の行へ回り込むことはない
+    set_geometry(mask, STRIDE, 0, 0, sym2d::NUM_TRANSFORMS);
+}
+
+uint64_t MiniGo2D::transform(uint64_t x, int t) const {
+    return sym2d::apply(x, t, n_size);
+}
+
+std::string MiniGo2D::analyze_parallel(int n, int m) {
+    set_board_size(n);
+    set_capture_target(m);
+    n = n_size;
+
+    std::vector<char> by_bit = analyze_first_moves();
+    std::string result(n * n, ' ');
+    for (int r = 0; r < n; ++r) {
+        for (int c = 0; c < n; ++c) {
+            result[r * n + c] = by_bit[bit_index(r, c)];
+        }
+    }
+    return result;
+}
+
+std::string MiniGo2D::format_rows(const std::string& res, int n) {
+    std::string out;
+    for (int r = 0; r < n; ++r) {
+        if (r > 0) out += '/';
+        out += res.substr(r * n, n);
+    }
+    return out;
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include "StoneSearch.h"
+
+// N x N の石取りゲーム (python/board.py, rules.py の C++ 版)
+// 盤面は 64bit ビットボード。1行を8ビットで持ち (Symmetry2D.h と同じ配置)、
+// 各行の列 N 以上を番兵にする (左右のシフトで隣の行へ回り込まない) ので N <= 7 まで扱える
+//   セル (r, c) のビット位置 = r * 8 + c
+// 探索は StoneSearch (対称性は8通りの回転・反転)
+class MiniGo2D : public StoneSearch {
+public:
+    static const int MAX_N = 7;
+
+    MiniGo2D(int tt_bits = 24);
+
+    // 空の盤面から黒が打つ各初手の結果を行優先で N*N 文字返す ('g'=勝ち, 'r'=負け, 'x'=自殺手)
+    // m: 先に m 個取った方が勝ち
+    std::string analyze_parallel(int n, int m = 1);
+
+    // 盤面サイズを設定する (変わったときだけTTをクリア)
+    void set_board_size(int n);
+    int get_board_size() const { return n_size; }
+
+    // セル (r, c) に打った結果 'g'/'r'/'x'
+    char evaluate_move(uint64_t my, uint64_t op, int r, int c, int my_cap = 0, int op_cap = 0) {
+        return evaluate_bit(my, op, 1ULL << bit_index(r, c), my_cap, op_cap);
+    }
+
+    int bit_index(int r, int c) const { return r * STRIDE + c; }
+
+    // Symmetry2D.h の変換 t (0..7)
+    uint64_t transform(uint64_t x, int t) const override;
+
+    // analyze_parallel の結果を "grg/rxr/grg" のように行ごとに区切る
+    static std::string format_rows(const std::string& res, int n);
+
+private:
+    static const int STRIDE = 8; // 1行のビット数
+
+    int n_size = 0;
+};
@@ -0,0 +1,56 @@
+#include "MiniGoStrip.h"
+
+MiniGoStrip::MiniGoStrip(int tt_bits) : StoneSearch(tt_bits) {}
+
+bool MiniGoStrip::set_board_size(int rows, int n) {
+    if (rows < 1 || n < 1 || rows * n > 63) return false;
+    if (rows == n_rows && n == n_cols) return true;
+    n_rows = rows;
+    n_cols = n;
+    col_mask = (1ULL << rows) - 1;
+    row0_mask = 0;
+    for (int c = 0; c < n; ++c) row0_mask |= 1ULL << (c * rows);
+    uint64_t top_mask = row0_mask << (rows - 1);
+
+    // 上下の隣は列の中の1ビットシフト。行 R-1 から上へ/行 0 から下へずらすと隣の列に入るので落とす
+    set_geometry((1ULL << (rows * n)) - 1, rows, row0_mask, top_mask, NUM_TRANSFORMS);
+    return true;
+}
+
+uint64_t MiniGoStrip::transform(uint64_t x, int t) const {
+    // 上下反転: 列の中の行の並びを逆にする (行ごとに取り出して置き直す)
+    auto flip_rows = [this](uint64_t v) {
+        uint64_t out = 0;
+        for (int r = 0; r < n_rows; ++r) out |= ((v >> r) & row0_mask) << (n_rows - 1 - r);
+        return out;
+    };
+    if (t & 1) {
+        // 全体のビット反転 = 180度回転。行を戻せば左右反転になる
+        uint64_t v = x;
+        v = ((v >> 1) & 0x5555555555555555ULL) | ((v & 0x5555555555555555ULL) << 1);
+        v = ((v >> 2) & 0x3333333333333333ULL) | ((v & 0x3333333333333333ULL) << 2);
+        v = ((v >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((v & 0x0F0F0F0F0F0F0F0FULL) << 4);
+        v = ((v >> 8) & 0x00FF00FF00FF00FFULL) | ((v & 0x00FF00FF00FF00FFULL) << 8);
+        v = ((v >> 16) & 0x0000FFFF0000FFFFULL) | ((v & 0x0000FFFF0000FFFFULL) << 16);
+        v = (v >> 32) | (v << 32);
+        x = flip_rows(v >> (64 - n_rows * n_cols));
+    }
+    if (t & 2) x = flip_rows(x);
+    return x;
+}
+
+std::string MiniGoStrip::analyze_parallel(int rows, int n, int m) {
+    if (!set_board_size(rows, n)) return "";
+    set_capture_target(m);
+
+    std::vector<char> by_bit = analyze_first_moves();
+
+    // 結果は MiniGo2D と同じく行優先で並べる
+    std::string result(rows * n, ' ');
+    for (int r = 0; r < rows; ++r) {
+        for (int c = 0; c < n; ++c) {
+            result[r * n + c] = by_bit[bit_index(r, c)];
+        }
+    }
+    return result;
+}
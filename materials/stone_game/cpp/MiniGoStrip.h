@@ -0,0 +1,47 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include "StoneSearch.h"
+
+// R x N の細長い盤 (R = 1..3) の石取りゲーム
+// 盤面は列ごとに R ビットずつ並べたビットボード (列優先)
+//   セル (r, c) のビット位置 = c * R + r
+// 1列が R ビットの小さなコードになるので、上下の隣は列の中の1ビットシフト、
+// 左右の隣は R ビットシフトで求まる。R*N <= 63 (3xN なら N <= 21)
+//
+// 探索は MiniGo2D と同じ StoneSearch (alpha-beta + 置換表 + Neighbor Priority)。
+// 対称性は左右反転・上下反転の4通り (正方形でも転置は使わない)
+class MiniGoStrip : public StoneSearch {
+public:
+    static const int NUM_TRANSFORMS = 4;
+
+    MiniGoStrip(int tt_bits = 24);
+
+    // 空の盤面から黒が打つ各初手の結果を行優先で R*N 文字返す ('g'=勝ち, 'r'=負け, 'x'=自殺手)
+    // m: 先に m 個取った方が勝ち
+    std::string analyze_parallel(int rows, int n, int m = 1);
+
+    // 盤の大きさを設定する (変わったときだけTTをクリア)。R*N が 63 を超えるなら false
+    bool set_board_size(int rows, int n);
+    int get_rows() const { return n_rows; }
+    int get_length() const { return n_cols; }
+
+    // セル (r, c) に打った結果 'g'/'r'/'x'
+    char evaluate_move(uint64_t my, uint64_t op, int r, int c, int my_cap = 0, int op_cap = 0) {
+        return evaluate_bit(my, op, 1ULL << bit_index(r, c), my_cap, op_cap);
+    }
+
+    int bit_index(int r, int c) const { return c * n_rows + r; }
+
+    // 列 c のコード (下位 R ビット、ビット r = 行 r)
+    uint64_t column(uint64_t stones, int c) const { return (stones >> (c * n_rows)) & col_mask; }
+
+    // 変換 t (0..3): bit0=左右反転, bit1=上下反転
+    uint64_t transform(uint64_t x, int t) const override;
+
+private:
+    int n_rows = 0;
+    int n_cols = 0;
+    uint64_t col_mask = 0;  // 1列ぶん
+    uint64_t row0_mask = 0; // 各列の行 0
+};
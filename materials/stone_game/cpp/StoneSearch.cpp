@@ -0,0 +1,232 @@
+#include "StoneSearch.h"
+#include <algorithm>
+#include <random>
+#include <cstring>
+#include <future>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#pragma intrinsic(_BitScanForward64)
+#endif
+
+// ビットスキャン関数のラッパー
+int StoneSearch::bit_scan_forward(uint64_t b) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, b);
+    return (int)index;
+#else
+    return __builtin_ctzll(b);
+#endif
+}
+
+int StoneSearch::popcount64(uint64_t b) {
+#if defined(_MSC_VER)
+    return (int)__popcnt64(b);
+#else
+    return __builtin_popcountll(b);
+#endif
+}
+
+StoneSearch::StoneSearch(int tt_bits) {
+    size_t size = 1ULL << tt_bits;
+    tt.resize(size);
+    tt_mask = size - 1;
+    init_zobrist();
+}
+
+void StoneSearch::init_zobrist() {
+    std::mt19937_64 rng(12345);
+    for (int i = 0; i < 64; ++i) {
+        zobrist_base[0][i] = rng();
+        zobrist_base[1][i] = rng();
+    }
+    for (int i = 0; i < 64; ++i) {
+        zobrist_cap_my[i] = (i == 0) ? 0 : rng();
+        zobrist_cap_op[i] = (i == 0) ? 0 : rng();
+    }
+    // 盤の形で変換先のセルが変わるので、zobrist_sym は set_geometry で作る
+    std::memset(zobrist_sym, 0, sizeof(zobrist_sym));
+}
+
+void StoneSearch::clear_tt() {
+    std::memset(tt.data(), 0, tt.size() * sizeof(TTEntry));
+}
+
+void StoneSearch::set_geometry(uint64_t mask, int stride_, uint64_t wrap_lo_, uint64_t wrap_hi_, int num_transforms_) {
+    board_mask = mask;
+    stride = stride_;
+    wrap_lo = wrap_lo_;
+    wrap_hi = wrap_hi_;
+    num_transforms = std::max(1, std::min(num_transforms_, MAX_TRANSFORMS));
+
+    // 変換 t で cell が移る先の乱数を引いておく
+    for (int t = 0; t < num_transforms; ++t) {
+        for (int cell = 0; cell < 64; ++cell) {
+            uint64_t bit = 1ULL << cell;
+            if (!(bit & board_mask)) {
+                zobrist_sym[t][0][cell] = zobrist_sym[t][1][cell] = 0;
+                continue;
+            }
+            int to = bit_scan_forward(transform(bit, t));
+            zobrist_sym[t][0][cell] = zobrist_base[0][to];
+            zobrist_sym[t][1][cell] = zobrist_base[1][to];
+        }
+    }
+    clear_tt();
+}
+
+void StoneSearch::set_capture_target(int m) {
+    m = std::max(1, std::min(m, 63));
+    if (m == capture_target) return;
+    capture_target = m;
+    clear_tt();
+}
+
+void StoneSearch::toggle_stones(SymKeys& keys, uint64_t stones, int color) const {
+    for (; stones; stones &= stones - 1) {
+        int cell = bit_scan_forward(stones);
+        for (int t = 0; t < num_transforms; ++t) {
+            keys.k[t][0] ^= zobrist_sym[t][color][cell];
+            keys.k[t][1] ^= zobrist_sym[t][color ^ 1][cell];
+        }
+    }
+}
+
+StoneSearch::SymKeys StoneSearch::compute_keys(uint64_t my, uint64_t op, int side) const {
+    SymKeys keys;
+    std::memset(&keys, 0, sizeof(keys));
+    toggle_stones(keys, my, side);
+    toggle_stones(keys, op, side ^ 1);
+    return keys;
+}
+
+// 1回のループで連全体に1マスずつ広がる。連の直径ぶん回れば止まる
+uint64_t StoneSearch::flood(uint64_t stones, uint64_t seed) const {
+    uint64_t group = seed & stones;
+    while (true) {
+        uint64_t next = (group | neighbors(group)) & stones;
+        if (next == group) return group;
+        group = next;
+    }
+}
+
+uint64_t StoneSearch::captured_by(uint64_t op, uint64_t empty_after, uint64_t move_bit) const {
+    uint64_t removed = 0;
+    uint64_t targets = neighbors(move_bit) & op;
+    while (targets) {
+        uint64_t seed = targets & (0 - targets);
+        uint64_t group = flood(op, seed);
+        targets &= ~group; // 同じ連に隣接する別の石は調べ直さない
+        if ((neighbors(group) & empty_after) == 0) removed |= group;
+    }
+    return removed;
+}
+
+int StoneSearch::solve(uint64_t my, uint64_t op, int my_cap, int op_cap, int side, const SymKeys& keys,
+                       int alpha, int beta, int depth) {
+    // 変換のうち最小のキーを代表にする
+    uint64_t key = keys.k[0][side];
+    for (int t = 1; t < num_transforms; ++t) key = std::min(key, keys.k[t][side]);
+    key ^= zobrist_cap_my[my_cap] ^ zobrist_cap_op[op_cap];
+    size_t idx = key & tt_mask;
+
+    TTEntry entry = tt[idx];
+    if (entry.flag && entry.key == key) {
+        return entry.score;
+    }
+
+    uint64_t empty = ~(my | op) & board_mask;
+
+    // MiniGoMT と同じ Neighbor Priority
+    // 1. 相手の石の隣 (取り・アタリの急所)  2. 自分の石の隣  3. その他
+    uint64_t op_adj = neighbors(op) & empty;
+    uint64_t my_adj = neighbors(my) & empty & ~op_adj;
+    uint64_t rest = empty & ~(op_adj | my_adj);
+    uint64_t order[3] = { op_adj, my_adj, rest };
+
+    int max_val = -1; // 合法手がなければ負け
+    for (int k = 0; k < 3; ++k) {
+        for (uint64_t moves = order[k]; moves; moves &= moves - 1) {
+            uint64_t move_bit = moves & (0 - moves);
+            uint64_t next_empty = empty & ~move_bit;
+            uint64_t next_my = my | move_bit;
+
+            uint64_t removed = captured_by(op, next_empty, move_bit);
+            int next_cap = my_cap;
+            if (removed) {
+                next_cap += popcount64(removed);
+                if (next_cap >= capture_target) {
+                    tt[idx] = {key, 1, 1};
+                    return 1;
+                }
+            } else if ((neighbors(flood(next_my, move_bit)) & next_empty) == 0) {
+                continue; // 自殺手
+            }
+
+            SymKeys child = keys;
+            toggle_stones(child, move_bit, side);
+            toggle_stones(child, removed, side ^ 1);
+            int score = -solve(op & ~removed, next_my, op_cap, next_cap, side ^ 1, child, -beta, -alpha, depth + 1);
+            if (score > max_val) {
+                max_val = score;
+                if (score >= beta) {
+                    tt[idx] = {key, (int16_t)max_val, 1};
+                    return max_val;
+                }
+                if (score > alpha) alpha = score;
+            }
+        }
+    }
+
+    tt[idx] = {key, (int16_t)max_val, 1};
+    return max_val;
+}
+
+int StoneSearch::solve_position(uint64_t my, uint64_t op, int my_cap, int op_cap) {
+    my &= board_mask;
+    op &= board_mask;
+    return solve(my, op, my_cap, op_cap, 0, compute_keys(my, op, 0), -1, 1, 0);
+}
+
+char StoneSearch::evaluate_bit(uint64_t my, uint64_t op, uint64_t move_bit, int my_cap, int op_cap) {
+    uint64_t empty = ~(my | op) & board_mask & ~move_bit;
+    uint64_t next_my = my | move_bit;
+
+    uint64_t removed = captured_by(op, empty, move_bit);
+    int next_cap = my_cap + popcount64(removed);
+    if (next_cap >= capture_target) return 'g';
+    if (!removed && (neighbors(flood(next_my, move_bit)) & empty) == 0) return 'x';
+
+    uint64_t next_op = op & ~removed;
+    int score = -solve(next_op, next_my, op_cap, next_cap, 1, compute_keys(next_op, next_my, 1), -1, 1, 1);
+    return (score == 1) ? 'g' : 'r';
+}
+
+std::vector<char> StoneSearch::analyze_first_moves() {
+    clear_tt();
+
+    // 空の盤面はどの変換でも不変なので、初手は対称類ごとに1つだけ解く
+    std::vector<int> rep(64, -1);
+    std::vector<int> reps;
+    for (uint64_t cells = board_mask; cells; cells &= cells - 1) {
+        int bit = bit_scan_forward(cells);
+        uint64_t best = 1ULL << bit;
+        for (int t = 1; t < num_transforms; ++t) best = std::min(best, transform(1ULL << bit, t));
+        rep[bit] = bit_scan_forward(best);
+        if (rep[bit] == bit) reps.push_back(bit);
+    }
+
+    std::vector<std::future<char>> futures;
+    for (int bit : reps) {
+        futures.push_back(std::async(std::launch::async, [this, bit]() {
+            return evaluate_bit(0, 0, 1ULL << bit);
+        }));
+    }
+    std::vector<char> by_bit(64, ' ');
+    for (size_t i = 0; i < reps.size(); ++i) by_bit[reps[i]] = futures[i].get();
+    for (int bit = 0; bit < 64; ++bit) {
+        if (rep[bit] >= 0) by_bit[bit] = by_bit[rep[bit]];
+    }
+    return by_bit;
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "TTEntry.h"
+
+// MiniGo2D と MiniGoStrip が共有する探索の本体
+// 盤の形で違うのは「セルのビット配置 (隣接の求め方)」と「対称変換」だけなので、派生クラスは
+//  - set_geometry で盤のマスクと隣接の求め方を渡し
+//  - transform で対称変換を与える
+// 置換表、変換ごとの Zobrist キーの差分更新、連の flood fill、取りの判定、alpha-beta はここにまとめる
+//
+// 隣接: 1ビットずらす向き (2D では左右、細長い盤では上下) と stride ビットずらす向きの4方向。
+// 1ビットずらしたときに前後の行/列から回り込んで入るセルは wrap_lo / wrap_hi で落とす
+class StoneSearch {
+public:
+    static const int MAX_TRANSFORMS = 8;
+
+    explicit StoneSearch(int tt_bits);
+    virtual ~StoneSearch() {}
+    StoneSearch(const StoneSearch&) = delete;
+    StoneSearch& operator=(const StoneSearch&) = delete;
+
+    // m: 先に m 個取った方が勝ち (変わったときだけTTをクリア)
+    void set_capture_target(int m);
+    int get_capture_target() const { return capture_target; }
+
+    // 手番側(my)から見た勝敗 1=勝ち, -1=負け
+    // my_cap/op_cap: それぞれがこれまでに取った石の数
+    int solve_position(uint64_t my, uint64_t op, int my_cap = 0, int op_cap = 0);
+
+    // move_bit に打った結果 'g'/'r'/'x'
+    char evaluate_bit(uint64_t my, uint64_t op, uint64_t move_bit, int my_cap = 0, int op_cap = 0);
+
+    // 変換 t (0..num_transforms-1) をかけた盤面。t=0 は恒等変換
+    virtual uint64_t transform(uint64_t x, int t) const = 0;
+
+protected:
+    uint64_t board_mask = 0;  // 盤内のセルだけ1
+    int capture_target = 1;
+
+    // 盤の形を設定して、変換ごとの Zobrist テーブルを作り直す (transform を呼ぶので派生クラスの設定後に呼ぶ)
+    void set_geometry(uint64_t mask, int stride, uint64_t wrap_lo, uint64_t wrap_hi, int num_transforms);
+    void clear_tt();
+
+    // 空の盤面から黒が打つ各初手の結果を、ビット位置ごとに返す (盤外は ' ')
+    // 初手は対称類ごとに代表 (変換後の最小のビット) だけを並列に解く
+    std::vector<char> analyze_first_moves();
+
+    static int bit_scan_forward(uint64_t b);
+    static int popcount64(uint64_t b);
+
+private:
+    int stride = 0;
+    uint64_t wrap_lo = 0;
+    uint64_t wrap_hi = 0;
+    int num_transforms = 1;
+
+    // Transposition Table
+    std::vector<TTEntry> tt;
+    uint64_t tt_mask;
+
+    // 変換ごとの Zobrist キー (差分更新する)
+    // k[t][s]: 色 s が手番のときの、変換 t をかけた盤面のキー (手番側の石は my 用の乱数)
+    // num_transforms 個の最小値を置換表のキーにすると、対称な局面が1エントリにまとまる
+    struct SymKeys {
+        uint64_t k[MAX_TRANSFORMS][2];
+    };
+
+    uint64_t zobrist_base[2][64];
+    // zobrist_sym[t][c][cell] = 色 c の石を cell に置いたときに k[t][0] に XOR する値
+    // (k[t][1] には zobrist_sym[t][c ^ 1][cell] を XOR する)
+    uint64_t zobrist_sym[MAX_TRANSFORMS][2][64];
+    uint64_t zobrist_cap_my[64]; // 取った石の数 (0 のときは 0)
+    uint64_t zobrist_cap_op[64];
+
+    void init_zobrist();
+
+    // color の石を stones の位置に置く/取り除く (XOR なので同じ操作)
+    void toggle_stones(SymKeys& keys, uint64_t stones, int color) const;
+    SymKeys compute_keys(uint64_t my, uint64_t op, int side) const;
+
+    // 上下左右に1マス広げる (盤外は落とす)
+    uint64_t neighbors(uint64_t x) const {
+        return (((x << 1) & ~wrap_lo) | ((x >> 1) & ~wrap_hi) | (x << stride) | (x >> stride)) & board_mask;
+    }
+
+    // seed を含む stones の連 (ビット並列の flood fill)
+    uint64_t flood(uint64_t stones, uint64_t seed) const;
+
+    // move_bit に打ったとき取れる相手の石 (取れなければ 0)
+    uint64_t captured_by(uint64_t op, uint64_t empty_after, uint64_t move_bit) const;
+
+    // side: 手番側の色 (キーの向きを決めるだけで、勝敗は my/op だけで決まる)
+    int solve(uint64_t my, uint64_t op, int my_cap, int op_cap, int side, const SymKeys& keys,
+              int alpha, int beta, int depth);
+};
@@ -0,0 +1,76 @@
+#pragma once
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <stdlib.h>
+#endif
+
+// N x N 盤 (N <= 8) の8通りの回転・反転 (二面体群 D4)
+// ビットボードは1行8ビット固定: セル (r, c) = ビット r*8 + c。盤は左上 (下位ビット側) に詰める
+// どの変換もデルタスワップ数回で済むので、局面ごとにループで1石ずつ動かすより速い
+namespace sym2d {
+
+const int NUM_TRANSFORMS = 8;
+
+// 上下反転 (行の順序を逆にする)
+inline uint64_t flip_vertical(uint64_t x, int n) {
+#if defined(_MSC_VER)
+    x = _byteswap_uint64(x);
+#else
+    x = __builtin_bswap64(x);
+#endif
+    return x >> (8 * (8 - n));
+}
+
+// 左右反転 (各行のビット順を逆にする)
+inline uint64_t mirror_horizontal(uint64_t x, int n) {
+    const uint64_t k1 = 0x5555555555555555ULL;
+    const uint64_t k2 = 0x3333333333333333ULL;
+    const uint64_t k4 = 0x0f0f0f0f0f0f0f0fULL;
+    x = ((x >> 1) & k1) | ((x & k1) << 1);
+    x = ((x >> 2) & k2) | ((x & k2) << 2);
+    x = ((x >> 4) & k4) | ((x & k4) << 4);
+    // 列 c は 7-c に来ているので n-1-c までずらす (列 n 以上は空なので行をまたがない)
+    return x >> (8 - n);
+}
+
+// 転置 (r, c) -> (c, r)。左上の N x N はその中で閉じる
+inline uint64_t transpose(uint64_t x) {
+    const uint64_t k1 = 0x5500550055005500ULL;
+    const uint64_t k2 = 0x3333000033330000ULL;
+    const uint64_t k4 = 0x0f0f0f0f00000000ULL;
+    uint64_t t;
+    t = k4 & (x ^ (x << 28));
+    x ^= t ^ (t >> 28);
+    t = k2 & (x ^ (x << 14));
+    x ^= t ^ (t >> 14);
+    t = k1 & (x ^ (x << 7));
+    x ^= t ^ (t >> 7);
+    return x;
+}
+
+// 変換番号 t (0..7): bit2=転置, bit0=左右反転, bit1=上下反転 の順に合成する。t=0 は恒等変換
+inline uint64_t apply(uint64_t x, int t, int n) {
+    if (t & 4) x = transpose(x);
+    if (t & 1) x = mirror_horizontal(x, n);
+    if (t & 2) x = flip_vertical(x, n);
+    return x;
+}
+
+// 8通りのうち (a, b) を辞書順で最小にする変換を返す (正規形の代表)
+inline int canonical_transform(uint64_t a, uint64_t b, int n) {
+    int best = 0;
+    uint64_t best_a = a, best_b = b;
+    for (int t = 1; t < NUM_TRANSFORMS; ++t) {
+        uint64_t ta = apply(a, t, n);
+        uint64_t tb = apply(b, t, n);
+        if (ta < best_a || (ta == best_a && tb < best_b)) {
+            best = t;
+            best_a = ta;
+            best_b = tb;
+        }
+    }
+    return best;
+}
+
+} // namespace sym2d
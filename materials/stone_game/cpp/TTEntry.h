@@ -0,0 +1,9 @@
+#pragma once
+#include <cstdint>
+
+// 置換表のエントリ (MiniGo2D, MiniGoStrip で共通)
+struct TTEntry {
+    uint64_t key;  // ハッシュキー (盤面ID)
+    int16_t score; // 評価値
+    uint8_t flag;  // 0:Empty, 1:Valid
+};
@@ -0,0 +1,239 @@
+#include "Tablebase2D.h"
+#include "Symmetry2D.h"
+#include <algorithm>
+#include <bitset>
+#include <cstring>
+#include <fstream>
+#include <thread>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+Tablebase2D::~Tablebase2D() {
+    close();
+}
+
+void Tablebase2D::close() {
+#if !defined(_WIN32)
+    if (mapped) munmap(mapped, mapped_size);
+#endif
+    mapped = nullptr;
+    mapped_size = 0;
+    data = nullptr;
+    owned.clear();
+    owned.shrink_to_fit();
+}
+
+void Tablebase2D::setup(int n) {
+    n_size = n;
+    board_mask = 0;
+    for (int r = 0; r < n; ++r) board_mask |= ((1ULL << n) - 1) << (r * 8);
+
+    num_entries = 1;
+    for (int i = 0; i < n * n; ++i) num_entries *= 3;
+
+    for (int r = 0; r < n; ++r) {
+        for (int bits = 0; bits < (1 << n); ++bits) {
+            uint32_t w = 0, p = 1;
+            for (int i = 0; i < r * n; ++i) p *= 3;
+            for (int c = 0; c < n; ++c, p *= 3) {
+                if ((bits >> c) & 1) w += p;
+            }
+            row_tern[r][bits] = w;
+        }
+    }
+}
+
+uint64_t Tablebase2D::index_of(uint64_t my, uint64_t op) const {
+    uint64_t row_mask = (1ULL << n_size) - 1;
+    uint64_t idx = 0;
+    for (int r = 0; r < n_size; ++r) {
+        idx += row_tern[r][(my >> (r * 8)) & row_mask];
+        idx += 2ULL * row_tern[r][(op >> (r * 8)) & row_mask];
+    }
+    return idx;
+}
+
+uint64_t Tablebase2D::alive(uint64_t stones, uint64_t empty) const {
+    uint64_t a = stones & neighbors(empty);
+    while (true) {
+        uint64_t next = (a | neighbors(a)) & stones;
+        if (next == a) return a;
+        a = next;
+    }
+}
+
+bool Tablebase2D::is_valid(uint64_t my, uint64_t op) const {
+    uint64_t empty = ~(my | op) & board_mask;
+    return alive(my, empty) == my && alive(op, empty) == op;
+}
+
+int Tablebase2D::lookup(uint64_t my, uint64_t op, const uint8_t* table) const {
+    int t = sym2d::canonical_transform(my, op, n_size);
+    return table[index_of(sym2d::apply(my, t, n_size), sym2d::apply(op, t, n_size))];
+}
+
+// 石が1つ多い局面 (相手の手番) は確定済み
+int Tablebase2D::solve_one(uint64_t my, uint64_t op, const uint8_t* table) const {
+    uint64_t empty = ~(my | op) & board_mask;
+    int result = LOSS; // 合法手がなければ負け
+    for (uint64_t moves = empty; moves; moves &= moves - 1) {
+        uint64_t move_bit = moves & (0 - moves);
+        uint64_t next_empty = empty & ~move_bit;
+        uint64_t next_my = my | move_bit;
+
+        if (alive(op, next_empty) != op) return WIN;           // 取れる (m=1 なので勝ち)
+        if (alive(next_my, next_empty) != next_my) continue;   // 自殺手
+        if (lookup(op, next_my, table) == LOSS) result = WIN;
+    }
+    return result;
+}
+
+// 石の数ごとに、多い方から1段ずつ確定させる。同じ段の局面は互いに依存しないので
+// 占有マスクをスレッドに振り分ける (書き込み先は局面ごとに別のバイト)
+bool Tablebase2D::generate(int n, int threads) {
+    if (n < 1 || n > MAX_N) return false;
+    close();
+    setup(n);
+    if (threads <= 0) threads = std::max(1u, std::thread::hardware_concurrency());
+
+    int cells = n * n;
+    std::vector<std::vector<uint32_t>> levels(cells + 1);
+    for (uint32_t occ = 0; occ < (1u << cells); ++occ) {
+        levels[std::bitset<32>(occ).count()].push_back(occ);
+    }
+
+    // 詰めたビット (cell = r*N + c) を1行8ビットの配置に広げる
+    auto spread = [n](uint32_t x) {
+        uint64_t out = 0;
+        for (int r = 0; r < n; ++r) out |= (uint64_t)((x >> (r * n)) & ((1u << n) - 1)) << (r * 8);
+        return out;
+    };
+
+    std::vector<uint8_t> work(num_entries, INVALID);
+    for (int k = cells; k >= 0; --k) {
+        const std::vector<uint32_t>& masks = levels[k];
+        auto task = [&](int tid) {
+            for (size_t i = tid; i < masks.size(); i += threads) {
+                uint64_t occ = spread(masks[i]);
+                // occ の部分集合を my、残りを op にして全部の塗り分けを回る
+                for (uint64_t s = occ;; s = (s - 1) & occ) {
+                    uint64_t my = s, op = occ ^ s;
+                    if (sym2d::canonical_transform(my, op, n) == 0 && is_valid(my, op)) {
+                        work[index_of(my, op)] = (uint8_t)solve_one(my, op, work.data());
+                    }
+                    if (s == 0) break;
+                }
+            }
+        };
+        std::vector<std::thread> pool;
+        for (int t = 0; t < threads; ++t) pool.emplace_back(task, t);
+        for (auto& th : pool) th.join();
+    }
+
+    // 正規形の値を全局面に写して2ビットに詰める
+    owned.assign((num_entries + 3) / 4, 0);
+    for (int k = 0; k <= cells; ++k) {
+        for (uint32_t m : levels[k]) {
+            uint64_t occ = spread(m);
+            for (uint64_t s = occ;; s = (s - 1) & occ) {
+                uint64_t idx = index_of(s, occ ^ s);
+                owned[idx >> 2] |= (uint8_t)(lookup(s, occ ^ s, work.data()) << ((idx & 3) * 2));
+                if (s == 0) break;
+            }
+        }
+    }
+    data = owned.data();
+    return true;
+}
+
+bool Tablebase2D::save(const std::string& path) const {
+    if (!data) return false;
+    std::ofstream ofs(path, std::ios::binary);
+    if (!ofs) return false;
+    Header h;
+    std::memset(&h, 0, sizeof(h));
+    std::memcpy(h.magic, "SGTB", 4);
+    h.version = 1;
+    h.n = (uint32_t)n_size;
+    h.m = 1;
+    h.num_entries = num_entries;
+    ofs.write(reinterpret_cast<const char*>(&h), sizeof(h));
+    ofs.write(reinterpret_cast<const char*>(data), (std::streamsize)((num_entries + 3) / 4));
+    return (bool)ofs;
+}
+
+bool Tablebase2D::open(const std::string& path) {
+    close();
+    Header h;
+#if !defined(_WIN32)
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(Header)) {
+        ::close(fd);
+        return false;
+    }
+    void* p = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED) return false;
+    mapped = p;
+    mapped_size = (size_t)st.st_size;
+    std::memcpy(&h, p, sizeof(h));
+    const uint8_t* body = static_cast<const uint8_t*>(p) + sizeof(Header);
+    size_t body_size = mapped_size - sizeof(Header);
+#else
+    std::ifstream ifs(path, std::ios::binary);
+    if (!ifs || !ifs.read(reinterpret_cast<char*>(&h), sizeof(h))) return false;
+    owned.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    const uint8_t* body = owned.data();
+    size_t body_size = owned.size();
+#endif
+
+    if (std::memcmp(h.magic, "SGTB", 4) != 0 || h.version != 1 || h.m != 1 ||
+        h.n < 1 || h.n > (uint32_t)MAX_N) {
+        close();
+        return false;
+    }
+    setup((int)h.n);
+    if (h.num_entries != num_entries || body_size < (num_entries + 3) / 4) {
+        close();
+        return false;
+    }
+    data = body;
+    return true;
+}
+
+int Tablebase2D::probe(uint64_t my, uint64_t op) const {
+    my &= board_mask;
+    op &= board_mask;
+    switch (value_at(index_of(my, op))) {
+    case WIN: return 1;
+    case LOSS: return -1;
+    default: return 0;
+    }
+}
+
+std::string Tablebase2D::first_move_map() const {
+    std::string result;
+    for (int r = 0; r < n_size; ++r) {
+        for (int c = 0; c < n_size; ++c) {
+            uint64_t move_bit = 1ULL << (r * 8 + c);
+            int v = probe(0, move_bit); // 打った後は相手の手番
+            result += (v == 0) ? 'x' : (v == -1) ? 'g' : 'r';
+        }
+    }
+    return result;
+}
+
+void Tablebase2D::count_values(uint64_t counts[3]) const {
+    counts[0] = counts[1] = counts[2] = 0;
+    for (uint64_t i = 0; i < num_entries; ++i) {
+        int v = value_at(i);
+        if (v < 3) ++counts[v];
+    }
+}
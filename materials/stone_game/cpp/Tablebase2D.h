@@ -0,0 +1,91 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <string>
+
+// N x N (N <= 4), m=1 の全局面の勝敗表 (後退解析)
+//
+// 局面は手番側 my / 相手 op で持ち、インデックスは各セルを 0=空, 1=my, 2=op とした3進数
+//   index = Σ digit(cell) * 3^cell   (cell = r*N + c)
+// 値は1局面2ビット: 0=不正な局面 (呼吸点のない連がある), 1=手番側の勝ち, 2=手番側の負け
+//
+// m=1 では取った時点で終局し、それ以外の手は石が1つ増えるので、
+// 石の数が多い局面から少ない局面へ1段ずつ確定させていける。
+// 解くのは対称類ごとに正規形 (Symmetry2D.h の canonical_transform) の1局面だけで、
+// 書き出すときに残りの局面へ値を写す (引くときは変換なしに O(1))
+//
+// ファイル形式 (リトルエンディアン、そのまま mmap して引ける)
+//   Header (32 バイト) + 値の配列 ((3^(N*N) + 3) / 4 バイト、1バイトに4局面、下位ビットから)
+class Tablebase2D {
+public:
+    static const int MAX_N = 4;
+
+    enum Value { INVALID = 0, WIN = 1, LOSS = 2 };
+
+    struct Header {
+        char magic[4];        // "SGTB"
+        uint32_t version;     // 1
+        uint32_t n;
+        uint32_t m;           // 勝利条件 (今は 1 のみ)
+        uint64_t num_entries; // 3^(N*N)
+        uint64_t reserved;
+    };
+
+    Tablebase2D() = default;
+    ~Tablebase2D();
+    Tablebase2D(const Tablebase2D&) = delete;
+    Tablebase2D& operator=(const Tablebase2D&) = delete;
+
+    // 全局面を解く。threads <= 0 ならハードウェアのスレッド数
+    bool generate(int n, int threads = 0);
+
+    bool save(const std::string& path) const;
+    // ファイルを mmap して読み込む (Windows ではメモリに読み込む)
+    bool open(const std::string& path);
+
+    int get_board_size() const { return n_size; }
+    uint64_t get_num_entries() const { return num_entries; }
+
+    // 盤面は MiniGo2D と同じ1行8ビットの配置 (セル (r, c) = ビット r*8 + c)
+    // 手番側から見て 1=勝ち, -1=負け, 0=不正な局面
+    int probe(uint64_t my, uint64_t op) const;
+
+    // 空の盤面からの初手マップ (MiniGo2D::analyze_parallel と同じ形式)
+    std::string first_move_map() const;
+
+    // 値ごとの局面数 (正規形だけでなく全局面) [INVALID, WIN, LOSS]
+    void count_values(uint64_t counts[3]) const;
+
+private:
+    int n_size = 0;
+    uint64_t board_mask = 0;
+    uint64_t num_entries = 0;
+
+    // 1行ぶん (N ビット) の3進数の重み: row_tern[r][bits] = Σ 3^(r*N + c)
+    uint32_t row_tern[MAX_N][1 << MAX_N];
+
+    std::vector<uint8_t> owned; // generate したとき、または mmap できないときの置き場
+    const uint8_t* data = nullptr;
+    void* mapped = nullptr;
+    size_t mapped_size = 0;
+
+    void setup(int n);
+    void close();
+
+    uint64_t neighbors(uint64_t x) const {
+        return ((x << 1) | (x >> 1) | (x << 8) | (x >> 8)) & board_mask;
+    }
+
+    uint64_t index_of(uint64_t my, uint64_t op) const;
+    int value_at(uint64_t index) const { return (data[index >> 2] >> ((index & 3) * 2)) & 3; }
+
+    // 空点に接している連の石 (呼吸点のある石) だけを返す
+    uint64_t alive(uint64_t stones, uint64_t empty) const;
+    // 呼吸点のない連が1つもないか
+    bool is_valid(uint64_t my, uint64_t op) const;
+
+    // 1局面を解く (石が1つ多い局面は確定済みであること)
+    int solve_one(uint64_t my, uint64_t op, const uint8_t* table) const;
+    int lookup(uint64_t my, uint64_t op, const uint8_t* table) const;
+};
@@ -0,0 +1,36 @@
+#include "MiniGo2D.h"
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <thread>
+
+int main() {
+    int from, to, m;
+    std::cout << "NxN MiniGo Solver (Parallel + Bitboard)\n";
+    std::cout << "CPU Cores: " << std::thread::hardware_concurrency() << "\n";
+    std::cout << "From: "; std::cin >> from;
+    std::cout << "To: "; std::cin >> to;
+    std::cout << "m (capture target): "; std::cin >> m;
+
+    // 27 = 2GB, 24 = 256MB
+    MiniGo2D solver(26);
+
+    std::string filename = "analysis_2d_" + std::to_string(from) + "-" + std::to_string(to) + "_m" + std::to_string(m) + ".csv";
+    std::ofstream ofs(filename);
+    ofs << "N,Result\n";
+
+    for (int n = from; n <= to && n <= MiniGo2D::MAX_N; ++n) {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        std::string res = solver.analyze_parallel(n, m);
+
+        auto end = std::chrono::high_resolution_clock::now();
+        double sec = std::chrono::duration<double>(end - start).count();
+
+        // 行ごとに '/' で区切る (例: 3x3 "rgr/ggg/rgr")
+        std::string rows = MiniGo2D::format_rows(res, n);
+        std::cout << "N=" << n << " : [" << rows << "] (" << sec << "s)\n";
+        ofs << n << "," << rows << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,46 @@
+#include "MiniGoStrip.h"
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <thread>
+
+int main() {
+    int rows, from, to, m;
+    std::cout << "RxN Strip MiniGo Solver (Column Bitboard)\n";
+    std::cout << "CPU Cores: " << std::thread::hardware_concurrency() << "\n";
+    std::cout << "Rows (1-3): "; std::cin >> rows;
+    std::cout << "From: "; std::cin >> from;
+    std::cout << "To: "; std::cin >> to;
+    std::cout << "m (capture target): "; std::cin >> m;
+
+    // 27 = 2GB, 24 = 256MB
+    MiniGoStrip solver(26);
+
+    std::string filename = "analysis_strip_" + std::to_string(rows) + "xN_" + std::to_string(from) + "-" +
+                           std::to_string(to) + "_m" + std::to_string(m) + ".csv";
+    std::ofstream ofs(filename);
+    ofs << "N,Result\n";
+
+    for (int n = from; n <= to; ++n) {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        std::string res = solver.analyze_parallel(rows, n, m);
+        if (res.empty()) {
+            std::cout << "N=" << n << " : too large (rows * N <= 63)\n";
+            break;
+        }
+
+        auto end = std::chrono::high_resolution_clock::now();
+        double sec = std::chrono::duration<double>(end - start).count();
+
+        // 行ごとに '/' で区切る (MiniGo2D と同じ形式)
+        std::string out;
+        for (int r = 0; r < rows; ++r) {
+            if (r > 0) out += '/';
+            out += res.substr(r * n, n);
+        }
+        std::cout << "N=" << n << " : [" << out << "] (" << sec << "s)\n";
+        ofs << n << "," << out << "\n";
+    }
+    return 0;
+}
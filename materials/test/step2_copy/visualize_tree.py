@@ -40,8 +40,10 @@ def visualize_game_tree(json_path, output_path="gametree.png"):
     # エッジ描画
     for node_key, node_data in nodes.items():
         children = node_data.get("children", {})
+        # TreeExporter の出力は親の optimal_moves に最善手を持つ
+        optimal_moves = {str(mv) for mv in node_data.get("optimal_moves", [])}
         for move, child_key in children.items():
-            is_optimal = False
+            is_optimal = str(move) in optimal_moves
             # 子ノードが最善手なら太線で描く
             if child_key in nodes and nodes[child_key].get("is_optimal", False):
                 is_optimal = True
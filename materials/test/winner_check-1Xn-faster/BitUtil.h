@@ -0,0 +1,120 @@
+#pragma once
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// 1xN ビットボード用の共通ヘルパー (ビット i = マス i)
+namespace bitutil {
+
+inline int lsb_index(uint64_t b) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, b);
+    return (int)index;
+#else
+    return __builtin_ctzll(b);
+#endif
+}
+
+inline int msb_index(uint64_t b) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse64(&index, b);
+    return (int)index;
+#else
+    return 63 - __builtin_clzll(b);
+#endif
+}
+
+inline int popcount(uint64_t b) {
+#if defined(_MSC_VER)
+    return (int)__popcnt64(b);
+#else
+    return __builtin_popcountll(b);
+#endif
+}
+
+// 下位 n ビットを左右反転する
+inline uint64_t reverse_bits(uint64_t x, int n) {
+    x = ((x >> 1) & 0x5555555555555555ULL) | ((x & 0x5555555555555555ULL) << 1);
+    x = ((x >> 2) & 0x3333333333333333ULL) | ((x & 0x3333333333333333ULL) << 2);
+    x = ((x >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((x & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    x = ((x >> 8) & 0x00FF00FF00FF00FFULL) | ((x & 0x00FF00FF00FF00FFULL) << 8);
+    x = ((x >> 16) & 0x0000FFFF0000FFFFULL) | ((x & 0x0000FFFF0000FFFFULL) << 16);
+    x = (x >> 32) | (x << 32);
+    return (n == 0) ? 0 : x >> (64 - n);
+}
+
+// idx を含む stones の連 (1次元なので区間) をビットマスクで返す
+inline uint64_t group_mask(uint64_t stones, int idx) {
+    uint64_t outside = ~stones;
+    uint64_t below = outside & ((1ULL << idx) - 1);
+    uint64_t above = (idx == 63) ? 0 : outside & ~((2ULL << idx) - 1);
+    int lo = (below == 0) ? 0 : msb_index(below) + 1;
+    int hi = (above == 0) ? 64 : lsb_index(above);
+    uint64_t upto_hi = (hi == 64) ? ~0ULL : ((1ULL << hi) - 1);
+    return upto_hi & ~((1ULL << lo) - 1);
+}
+
+// idx を含む連に呼吸点があるか (empty は盤内の空点のみを持つこと)
+inline bool group_has_liberty(uint64_t stones, uint64_t empty, int idx) {
+    uint64_t group = group_mask(stones, idx);
+    return (((group << 1) | (group >> 1)) & empty) != 0;
+}
+
+// 連の中だけで x を下位ビット側 / 上位ビット側へ広げる (occluded fill、6 段)
+inline uint64_t fill_down(uint64_t x, uint64_t run) {
+    x |= (x >> 1) & run;  run &= run >> 1;
+    x |= (x >> 2) & run;  run &= run >> 2;
+    x |= (x >> 4) & run;  run &= run >> 4;
+    x |= (x >> 8) & run;  run &= run >> 8;
+    x |= (x >> 16) & run; run &= run >> 16;
+    x |= (x >> 32) & run;
+    return x;
+}
+
+inline uint64_t fill_up(uint64_t x, uint64_t run) {
+    x |= (x << 1) & run;  run &= run << 1;
+    x |= (x << 2) & run;  run &= run << 2;
+    x |= (x << 4) & run;  run &= run << 4;
+    x |= (x << 8) & run;  run &= run << 8;
+    x |= (x << 16) & run; run &= run << 16;
+    x |= (x << 32) & run;
+    return x;
+}
+
+// 打てば stones の連を取れる空点 (呼吸点が1つしかない連の、その呼吸点) をまとめて返す
+// empty は盤内の空点のみを持つこと (盤の外は空点でないので、端に接した側はふさがっている扱い)
+inline uint64_t capture_points(uint64_t stones, uint64_t empty) {
+    uint64_t starts = stones & ~(stones << 1); // 連の左端 (下位ビット側)
+    uint64_t ends = stones & ~(stones >> 1);   // 連の右端
+    // 右側がふさがった連は左の呼吸点に打てば取れる
+    uint64_t right_blocked = fill_down(ends & ~(empty >> 1), stones);
+    // 左側がふさがった連は右の呼吸点に打てば取れる
+    uint64_t left_blocked = fill_up(starts & ~(empty << 1), stones);
+    return (((right_blocked & starts) >> 1) | ((left_blocked & ends) << 1)) & empty;
+}
+
+// mover が空点 idx に打ったときの結果 (盤の大きさ n)
+enum MoveResult { MOVE_ILLEGAL = 0, MOVE_NORMAL = 1, MOVE_CAPTURE = 2 };
+
+inline MoveResult try_move(uint64_t mover, uint64_t other, int idx, int n) {
+    uint64_t full_mask = (n >= 64) ? ~0ULL : ((1ULL << n) - 1);
+    uint64_t move_bit = 1ULL << idx;
+    uint64_t next_empty = ~(mover | other | move_bit) & full_mask;
+
+    // 隣の相手の連を取れるか
+    if (idx > 0 && ((other >> (idx - 1)) & 1) && !group_has_liberty(other, next_empty, idx - 1)) {
+        return MOVE_CAPTURE;
+    }
+    if (idx < n - 1 && ((other >> (idx + 1)) & 1) && !group_has_liberty(other, next_empty, idx + 1)) {
+        return MOVE_CAPTURE;
+    }
+    // 自殺手
+    if (!group_has_liberty(mover | move_bit, next_empty, idx)) return MOVE_ILLEGAL;
+    return MOVE_NORMAL;
+}
+
+} // namespace bitutil
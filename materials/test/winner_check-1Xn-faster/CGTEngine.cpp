@@ -0,0 +1,305 @@
+#include "CGTEngine.h"
+#include <algorithm>
+#include <cstdlib>
+
+CGTEngine::CGTEngine() {
+    // ID 0 は必ず 0 = { | }
+    intern({}, {});
+    star_id = make({zero()}, {zero()});
+}
+
+GameId CGTEngine::integer(int k) {
+    GameId g = zero();
+    for (int i = 0; i < std::abs(k); ++i) g = (k > 0) ? make({g}, {}) : make({}, {g});
+    return g;
+}
+
+uint64_t CGTEngine::hash_options(const std::vector<GameId>& left, const std::vector<GameId>& right) {
+    // FNV-1a 風の混ぜ合わせ。左右の区切りを入れて {a|} と {|a} を区別する
+    uint64_t h = 1469598103934665603ULL;
+    for (GameId id : left) h = (h ^ (uint64_t)(uint32_t)id) * 1099511628211ULL;
+    h = (h ^ 0xFFFFFFFFULL) * 1099511628211ULL;
+    for (GameId id : right) h = (h ^ (uint64_t)(uint32_t)id) * 1099511628211ULL;
+    return h;
+}
+
+GameId CGTEngine::intern(const std::vector<GameId>& left, const std::vector<GameId>& right) {
+    uint64_t h = hash_options(left, right);
+    auto range = intern_table.equal_range(h);
+    for (auto it = range.first; it != range.second; ++it) {
+        const Node& node = nodes[it->second];
+        if (node.left == left && node.right == right) return it->second;
+    }
+
+    Node node;
+    node.left = left;
+    node.right = right;
+    node.hash = h;
+    classify(node);
+
+    GameId id = (GameId)nodes.size();
+    nodes.push_back(std::move(node));
+    intern_table.emplace(h, id);
+    return id;
+}
+
+// 数 / 数+星 の判定。標準形であることを前提にしている
+void CGTEngine::classify(Node& node) const {
+    auto less_number = [&](const Node& a, const Node& b) {
+        int k = std::max(a.den_log, b.den_log);
+        return (a.num << (k - a.den_log)) < (b.num << (k - b.den_log));
+    };
+
+    bool all_numbers = true;
+    for (GameId id : node.left) all_numbers = all_numbers && nodes[id].is_number;
+    for (GameId id : node.right) all_numbers = all_numbers && nodes[id].is_number;
+
+    if (all_numbers && node.left.size() <= 1 && node.right.size() <= 1) {
+        if (node.left.empty() && node.right.empty()) {
+            node.is_number = true;
+            node.num = 0;
+            node.den_log = 0;
+        } else if (node.right.empty()) {
+            // {n-1 | } = n
+            const Node& a = nodes[node.left[0]];
+            node.is_number = true;
+            node.num = (a.num >> a.den_log) + 1;
+            node.den_log = 0;
+        } else if (node.left.empty()) {
+            // { | -n+1} = -n
+            const Node& b = nodes[node.right[0]];
+            node.is_number = true;
+            node.num = -((-b.num) >> b.den_log) - 1;
+            node.den_log = 0;
+        } else if (less_number(nodes[node.left[0]], nodes[node.right[0]])) {
+            // {a | b} = (a+b)/2
+            const Node& a = nodes[node.left[0]];
+            const Node& b = nodes[node.right[0]];
+            int k = std::max(a.den_log, b.den_log);
+            node.is_number = true;
+            node.num = (a.num << (k - a.den_log)) + (b.num << (k - b.den_log));
+            node.den_log = k + 1;
+            while (node.den_log > 0 && node.num % 2 == 0) {
+                node.num /= 2;
+                node.den_log--;
+            }
+        }
+    }
+
+    if (node.is_number) {
+        node.is_num_nim = true;
+        node.nim = 0;
+        return;
+    }
+
+    // x + *k = {x, x*, ..., x*(k-1) | 同じ}
+    if (node.left.empty() || node.left != node.right) return;
+    const Node& first = nodes[node.left[0]];
+    std::vector<bool> seen(node.left.size(), false);
+    for (GameId id : node.left) {
+        const Node& opt = nodes[id];
+        if (!opt.is_num_nim || opt.num != first.num || opt.den_log != first.den_log) return;
+        if (opt.nim >= (int)seen.size() || seen[opt.nim]) return;
+        seen[opt.nim] = true;
+    }
+    node.is_num_nim = true;
+    node.num = first.num;
+    node.den_log = first.den_log;
+    node.nim = (int)node.left.size();
+}
+
+bool CGTEngine::le(GameId g, GameId h) {
+    if (g == h) return true;
+    uint64_t key = ((uint64_t)(uint32_t)g << 32) | (uint32_t)h;
+    auto it = le_cache.find(key);
+    if (it != le_cache.end()) return it->second;
+
+    // G <= H  <=>  H <= G^L となる G^L が無く、かつ H^R <= G となる H^R が無い
+    bool result = true;
+    for (GameId gl : nodes[g].left) {
+        if (le(h, gl)) { result = false; break; }
+    }
+    if (result) {
+        for (GameId hr : nodes[h].right) {
+            if (le(hr, g)) { result = false; break; }
+        }
+    }
+    le_cache[key] = result;
+    return result;
+}
+
+bool CGTEngine::le_to_temp(GameId x, const std::vector<GameId>& L, const std::vector<GameId>& R) {
+    // X <= G
+    for (GameId xl : nodes[x].left) {
+        if (le_from_temp(L, R, xl)) return false;
+    }
+    for (GameId gr : R) {
+        if (le(gr, x)) return false;
+    }
+    return true;
+}
+
+bool CGTEngine::le_from_temp(const std::vector<GameId>& L, const std::vector<GameId>& R, GameId x) {
+    // G <= X
+    for (GameId gl : L) {
+        if (le(x, gl)) return false;
+    }
+    for (GameId xr : nodes[x].right) {
+        if (le_to_temp(xr, L, R)) return false;
+    }
+    return true;
+}
+
+GameId CGTEngine::make(std::vector<GameId> left, std::vector<GameId> right) {
+    while (true) {
+        std::sort(left.begin(), left.end());
+        left.erase(std::unique(left.begin(), left.end()), left.end());
+        std::sort(right.begin(), right.end());
+        right.erase(std::unique(right.begin(), right.end()), right.end());
+
+        // 1. 支配された選択肢の除去 (左は小さい方、右は大きい方を捨てる)
+        std::vector<GameId> new_left, new_right;
+        for (GameId a : left) {
+            bool dominated = false;
+            for (GameId b : left) {
+                if (a != b && le(a, b)) { dominated = true; break; }
+            }
+            if (!dominated) new_left.push_back(a);
+        }
+        for (GameId a : right) {
+            bool dominated = false;
+            for (GameId b : right) {
+                if (a != b && le(b, a)) { dominated = true; break; }
+            }
+            if (!dominated) new_right.push_back(a);
+        }
+        left.swap(new_left);
+        right.swap(new_right);
+
+        // 2. 可逆手のバイパス (1つ見つけるたびにやり直す)
+        bool changed = false;
+        for (size_t i = 0; i < left.size() && !changed; ++i) {
+            // G^L の右選択肢 G^LR で G^LR <= G なら G^L を G^LR の左選択肢で置き換える
+            std::vector<GameId> glr = nodes[left[i]].right;
+            for (GameId x : glr) {
+                if (le_to_temp(x, left, right)) {
+                    std::vector<GameId> replacement = nodes[x].left;
+                    left.erase(left.begin() + i);
+                    left.insert(left.end(), replacement.begin(), replacement.end());
+                    changed = true;
+                    break;
+                }
+            }
+        }
+        for (size_t i = 0; i < right.size() && !changed; ++i) {
+            std::vector<GameId> grl = nodes[right[i]].left;
+            for (GameId x : grl) {
+                if (le_from_temp(left, right, x)) {
+                    std::vector<GameId> replacement = nodes[x].right;
+                    right.erase(right.begin() + i);
+                    right.insert(right.end(), replacement.begin(), replacement.end());
+                    changed = true;
+                    break;
+                }
+            }
+        }
+        if (!changed) break;
+    }
+    return intern(left, right);
+}
+
+GameId CGTEngine::negate(GameId g) {
+    auto it = neg_cache.find(g);
+    if (it != neg_cache.end()) return it->second;
+
+    // make() が nodes を伸ばすので選択肢はコピーしてから使う
+    std::vector<GameId> left = nodes[g].left;
+    std::vector<GameId> right = nodes[g].right;
+    std::vector<GameId> neg_left, neg_right;
+    for (GameId r : right) neg_left.push_back(negate(r));
+    for (GameId l : left) neg_right.push_back(negate(l));
+
+    GameId result = make(neg_left, neg_right);
+    neg_cache[g] = result;
+    neg_cache[result] = g;
+    return result;
+}
+
+GameId CGTEngine::add(GameId g, GameId h) {
+    if (g == zero()) return h;
+    if (h == zero()) return g;
+    if (g > h) std::swap(g, h);
+    uint64_t key = ((uint64_t)(uint32_t)g << 32) | (uint32_t)h;
+    auto it = add_cache.find(key);
+    if (it != add_cache.end()) return it->second;
+
+    // G + H = {G^L + H, G + H^L | G^R + H, G + H^R}
+    std::vector<GameId> gl = nodes[g].left, gr = nodes[g].right;
+    std::vector<GameId> hl = nodes[h].left, hr = nodes[h].right;
+    std::vector<GameId> left, right;
+    for (GameId x : gl) left.push_back(add(x, h));
+    for (GameId x : hl) left.push_back(add(g, x));
+    for (GameId x : gr) right.push_back(add(x, h));
+    for (GameId x : hr) right.push_back(add(g, x));
+
+    GameId result = make(left, right);
+    add_cache[key] = result;
+    return result;
+}
+
+std::string CGTEngine::outcome_class(GameId g) {
+    bool ge_zero = le(zero(), g);
+    bool le_zero = le(g, zero());
+    if (ge_zero && le_zero) return "P";
+    if (ge_zero) return "L";
+    if (le_zero) return "R";
+    return "N";
+}
+
+double CGTEngine::number_value(GameId g) const {
+    const Node& node = nodes[g];
+    return (double)node.num / (double)(1LL << node.den_log);
+}
+
+std::string CGTEngine::number_string(int64_t num, int den_log) const {
+    if (den_log == 0) return std::to_string(num);
+    return std::to_string(num) + "/" + std::to_string(1LL << den_log);
+}
+
+std::string CGTEngine::to_string(GameId g) {
+    auto it = name_cache.find(g);
+    if (it != name_cache.end()) return it->second;
+
+    const Node& node = nodes[g];
+    std::string s;
+    if (node.is_num_nim) {
+        std::string star = (node.nim == 0) ? "" : (node.nim == 1) ? "*" : "*" + std::to_string(node.nim);
+        if (node.num == 0 && node.nim > 0) s = star;
+        else s = number_string(node.num, node.den_log) + star;
+    } else {
+        std::vector<GameId> zero_star = {zero(), star_id};
+        std::vector<GameId> only_zero = {zero()};
+        std::vector<GameId> only_star = {star_id};
+        if (node.left == only_zero && node.right == only_star) s = "↑";
+        else if (node.left == only_star && node.right == only_zero) s = "↓";
+        else if (node.left == zero_star && node.right == only_zero) s = "↑*";
+        else if (node.left == only_zero && node.right == zero_star) s = "↓*";
+        else {
+            std::vector<GameId> left = node.left;
+            std::vector<GameId> right = node.right;
+            s = "{";
+            for (size_t i = 0; i < left.size(); ++i) {
+                if (i) s += ",";
+                s += to_string(left[i]);
+            }
+            s += "|";
+            for (size_t i = 0; i < right.size(); ++i) {
+                if (i) s += ",";
+                s += to_string(right[i]);
+            }
+            s += "}";
+        }
+    }
+    name_cache[g] = s;
+    return s;
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// 組み合わせゲームの値 (ノードID)。同じ値のゲームは必ず同じIDになる (ハッシュコンス)
+using GameId = int32_t;
+
+// 組み合わせゲーム理論の値エンジン
+// - ゲームは {左選択肢 | 右選択肢} のDAGとして保持し、選択肢集合ごとに1ノードだけ作る
+// - make() は必ず標準形 (支配された選択肢の除去 + 可逆手のバイパス) を返すので
+//   値の等号判定は ID の比較だけで済む
+// - 大小比較 le() はIDの組ごとにメモ化する
+class CGTEngine {
+public:
+    CGTEngine();
+
+    // 0 = { | }
+    GameId zero() const { return 0; }
+
+    // 整数 k (k = {k-1 | }, -k = { | -(k-1)})
+    GameId integer(int k);
+
+    // 選択肢 (どちらも標準形のID) からゲームを作り、標準形のIDを返す
+    GameId make(std::vector<GameId> left, std::vector<GameId> right);
+
+    // G <= H
+    bool le(GameId g, GameId h);
+
+    // -G (左右の選択肢を入れ替えたゲーム)
+    GameId negate(GameId g);
+
+    // G + H (直和)
+    GameId add(GameId g, GameId h);
+
+    // 帰結類 "L" (G>0), "R" (G<0), "P" (G=0), "N" (G||0)
+    std::string outcome_class(GameId g);
+
+    // 表示用文字列 (例: "0", "1/2", "*", "↑", "{1|-1}")
+    std::string to_string(GameId g);
+
+    const std::vector<GameId>& left_options(GameId g) const { return nodes[g].left; }
+    const std::vector<GameId>& right_options(GameId g) const { return nodes[g].right; }
+
+    // 数 (number) なら分子/2^den_log を返す
+    bool is_number(GameId g) const { return nodes[g].is_number; }
+    double number_value(GameId g) const;
+
+    size_t size() const { return nodes.size(); }
+    size_t compare_cache_size() const { return le_cache.size(); }
+
+private:
+    struct Node {
+        std::vector<GameId> left;
+        std::vector<GameId> right;
+        uint64_t hash;
+
+        // 数 + 星 (x + *k) の形なら num/2^den_log と nim を持つ
+        bool is_number = false;
+        bool is_num_nim = false;
+        int64_t num = 0;
+        int den_log = 0;
+        int nim = 0;
+    };
+
+    std::vector<Node> nodes;
+    GameId star_id;
+    std::unordered_multimap<uint64_t, GameId> intern_table;
+    std::unordered_map<uint64_t, bool> le_cache;
+    std::unordered_map<GameId, GameId> neg_cache;
+    std::unordered_map<uint64_t, GameId> add_cache;
+    std::unordered_map<GameId, std::string> name_cache;
+
+    static uint64_t hash_options(const std::vector<GameId>& left, const std::vector<GameId>& right);
+
+    // 既に標準形になっている選択肢集合を登録する
+    GameId intern(const std::vector<GameId>& left, const std::vector<GameId>& right);
+    void classify(Node& node) const;
+
+    // 未登録の一時的なゲーム G = {L|R} との比較 (可逆手の判定用)
+    bool le_to_temp(GameId x, const std::vector<GameId>& L, const std::vector<GameId>& R);
+    bool le_from_temp(const std::vector<GameId>& L, const std::vector<GameId>& R, GameId x);
+
+    std::string number_string(int64_t num, int den_log) const;
+};
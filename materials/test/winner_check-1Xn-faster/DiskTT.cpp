@@ -0,0 +1,133 @@
+#include "DiskTT.h"
+#include <cstdio>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+DiskTT::~DiskTT() {
+    close();
+}
+
+bool DiskTT::open(const std::string& path, int bits) {
+    close();
+    if (bits < 2 || bits > 40) return false;
+    file_path = path;
+    bucket_mask = (1ULL << (bits - 2)) - 1; // BUCKET = 4 エントリずつ
+    used.reset(new std::atomic<uint64_t>[(bucket_mask >> 6) + 1]());
+    if (!map_file()) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void DiskTT::close() {
+    unmap_file();
+    used.reset();
+    // 中身は探索中だけ意味があるので、ファイルは残さない
+    if (!file_path.empty()) std::remove(file_path.c_str());
+    file_path.clear();
+}
+
+bool DiskTT::clear() {
+    if (!table) return false;
+    unmap_file();
+    if (!map_file()) {
+        // 作り直せなかった (ディスクがいっぱいなど)。半端な状態で使わないように閉じる
+        close();
+        return false;
+    }
+    for (size_t i = 0; i <= (bucket_mask >> 6); ++i) used[i].store(0, std::memory_order_relaxed);
+    n_probes.store(0, std::memory_order_relaxed);
+    n_hits.store(0, std::memory_order_relaxed);
+    n_stores.store(0, std::memory_order_relaxed);
+    return true;
+}
+
+#if defined(_WIN32)
+
+bool DiskTT::map_file() {
+    HANDLE f = CreateFileA(file_path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+                           FILE_ATTRIBUTE_TEMPORARY, nullptr);
+    if (f == INVALID_HANDLE_VALUE) return false;
+    file_handle = f;
+    LARGE_INTEGER size;
+    size.QuadPart = (LONGLONG)size_bytes();
+    HANDLE m = CreateFileMappingA(f, nullptr, PAGE_READWRITE, size.HighPart, size.LowPart, nullptr);
+    if (!m) return false;
+    mapping_handle = m;
+    table = (TTEntry*)MapViewOfFile(m, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+    return table != nullptr;
+}
+
+void DiskTT::unmap_file() {
+    if (table) UnmapViewOfFile(table);
+    if (mapping_handle) CloseHandle((HANDLE)mapping_handle);
+    if (file_handle) CloseHandle((HANDLE)file_handle);
+    table = nullptr;
+    mapping_handle = nullptr;
+    file_handle = nullptr;
+}
+
+#else
+
+bool DiskTT::map_file() {
+    // 作り直すたびに長さ 0 から伸ばすので、中身は全部 0 (= 空) になる
+    fd = ::open(file_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) return false;
+    if (ftruncate(fd, (off_t)size_bytes()) != 0) return false;
+    void* p = mmap(nullptr, size_bytes(), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (p == MAP_FAILED) return false;
+    // 引く位置はハッシュで決まるので先読みは無駄になる
+    madvise(p, size_bytes(), MADV_RANDOM);
+    table = (TTEntry*)p;
+    return true;
+}
+
+void DiskTT::unmap_file() {
+    if (table) munmap(table, size_bytes());
+    if (fd >= 0) ::close(fd);
+    table = nullptr;
+    fd = -1;
+}
+
+#endif
+
+bool DiskTT::probe(uint64_t key, int16_t& score) {
+    n_probes.fetch_add(1, std::memory_order_relaxed);
+    size_t b = key & bucket_mask;
+    if (!((used[b >> 6].load(std::memory_order_relaxed) >> (b & 63)) & 1)) return false;
+    const TTEntry* bucket = table + b * BUCKET;
+    for (int i = 0; i < BUCKET; ++i) {
+        if (bucket[i].flag && bucket[i].key == key) {
+            score = bucket[i].score;
+            n_hits.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+void DiskTT::store(const TTEntry& e) {
+    size_t b = e.key & bucket_mask;
+    TTEntry* bucket = table + b * BUCKET;
+    // 同じキー > 空き > 一番深い (部分木が小さい) エントリ の順に置き換える
+    int victim = 0;
+    for (int i = 0; i < BUCKET; ++i) {
+        if (!bucket[i].flag || bucket[i].key == e.key) {
+            victim = i;
+            break;
+        }
+        if (bucket[i].depth > bucket[victim].depth) victim = i;
+    }
+    // 置き換え先より深い (小さい部分木の) 結果なら入れない
+    if (bucket[victim].flag && bucket[victim].key != e.key && bucket[victim].depth < e.depth) return;
+    bucket[victim] = e;
+    used[b >> 6].fetch_or(1ULL << (b & 63), std::memory_order_relaxed);
+    n_stores.fetch_add(1, std::memory_order_relaxed);
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include "TTEntry.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// 置換表の2段目: ローカルディスク上の大きなファイルをメモリマップして使う
+//
+// MiniGoMT の RAM の置換表から追い出された浅い局面 (= 大きな部分木の結果) を受け取り、
+// 浅い深さで RAM の表に無かったときだけ引く。RAM に収まらない N でも、解いた大きな部分木を捨てずに済む
+//
+// 4 エントリ (64 バイト) を1つのバケットにし、同じキーか空きがなければ一番深いエントリを置き換える。
+// 書いたことのあるバケットは RAM のビット列 (1 バケット 1 ビット) で覚えておき、空のバケットはファイルに触れずに外れとする
+// (まだ書いていないページを読むとページフォールトになるので)
+// RAM の表と同じく排他制御はしない (スレッド間で書き込みが重なっても探索が遅くなるだけ、という前提も同じ)
+class DiskTT {
+public:
+    static const int BUCKET = 4;
+
+    DiskTT() {}
+    ~DiskTT();
+    DiskTT(const DiskTT&) = delete;
+    DiskTT& operator=(const DiskTT&) = delete;
+
+    // path に 2^bits エントリ (16 バイト/エントリ) のファイルを作ってマップする。失敗したら false
+    bool open(const std::string& path, int bits);
+    void close();
+    bool is_open() const { return table != nullptr; }
+
+    // 全エントリを空にする (ファイルを切り詰めて作り直すので、書いていないページはディスクを使わない)
+    // 開いていないか作り直しに失敗したら false (失敗したときは閉じる)
+    bool clear();
+
+    bool probe(uint64_t key, int16_t& score);
+    void store(const TTEntry& e);
+
+    size_t size_bytes() const { return (bucket_mask + 1) * BUCKET * sizeof(TTEntry); }
+
+    // 統計 (概数)
+    uint64_t probes() const { return n_probes.load(std::memory_order_relaxed); }
+    uint64_t hits() const { return n_hits.load(std::memory_order_relaxed); }
+    uint64_t stores() const { return n_stores.load(std::memory_order_relaxed); }
+
+private:
+    TTEntry* table = nullptr;
+    size_t bucket_mask = 0;
+    std::unique_ptr<std::atomic<uint64_t>[]> used; // バケットごとに1ビット
+    std::string file_path;
+#if defined(_WIN32)
+    void* file_handle = nullptr;
+    void* mapping_handle = nullptr;
+#else
+    int fd = -1;
+#endif
+
+    std::atomic<uint64_t> n_probes{0};
+    std::atomic<uint64_t> n_hits{0};
+    std::atomic<uint64_t> n_stores{0};
+
+    bool map_file();
+    void unmap_file();
+};
@@ -0,0 +1,79 @@
+#include "EquivFinder.h"
+#include "ValueSolver.h"
+#include <algorithm>
+#include <future>
+
+EquivFinder::EquivFinder(CGTEngine& e) : engine(e) {}
+
+void EquivFinder::collect(int max_n) {
+    ValueSolver solver(engine);
+    for (int n = 1; n <= max_n; ++n) {
+        solver.set_board_size(n);
+        solver.value(0, 0);
+        solver.for_each_position([&](uint64_t black, uint64_t white, GameId g) {
+            buckets[g].push_back({n, black, white, false});
+            ++position_count;
+        });
+    }
+
+    // 小さい盤・小さいビット列を先頭 (代表) にする
+    for (auto& [g, members] : buckets) {
+        std::sort(members.begin(), members.end(), [](const RowPosition& a, const RowPosition& b) {
+            if (a.n != b.n) return a.n < b.n;
+            if (a.black != b.black) return a.black < b.black;
+            return a.white < b.white;
+        });
+    }
+}
+
+std::string EquivFinder::board_string(const RowPosition& p) {
+    std::string s;
+    for (int i = 0; i < p.n; ++i) {
+        if (i) s += ",";
+        if ((p.black >> i) & 1) s += "1";
+        else if ((p.white >> i) & 1) s += "-1";
+        else s += "0";
+    }
+    return s;
+}
+
+EquivFinder::VerifyResult EquivFinder::verify(int max_n, int max_pairs, int threads) {
+    // 調べる組 (G, H) を列挙
+    std::vector<std::pair<RowPosition, RowPosition>> pairs;
+    for (const auto& [g, members] : buckets) {
+        if (members.size() < 2 || members[0].n > max_n) continue;
+        int count = 0;
+        for (size_t i = 1; i < members.size() && count < max_pairs; ++i) {
+            if (members[i].n > max_n) continue;
+            pairs.emplace_back(members[0], members[i]);
+            ++count;
+        }
+    }
+
+    if (threads < 1) threads = 1;
+    auto task_func = [&](int t) -> VerifyResult {
+        VerifyResult res;
+        SumSearch search;
+        for (size_t i = t; i < pairs.size(); i += threads) {
+            std::vector<RowPosition> rows = {pairs[i].first, pairs[i].second.negated()};
+            ++res.checked;
+            if (search.outcome_class(rows) == 'P') ++res.passed;
+            else res.failures.push_back(pairs[i]);
+        }
+        return res;
+    };
+
+    std::vector<std::future<VerifyResult>> futures;
+    for (int t = 0; t < threads; ++t) {
+        futures.push_back(std::async(std::launch::async, task_func, t));
+    }
+
+    VerifyResult total;
+    for (auto& f : futures) {
+        VerifyResult res = f.get();
+        total.checked += res.checked;
+        total.passed += res.passed;
+        total.failures.insert(total.failures.end(), res.failures.begin(), res.failures.end());
+    }
+    return total;
+}
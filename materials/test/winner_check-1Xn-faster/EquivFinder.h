@@ -0,0 +1,38 @@
+#pragma once
+#include "CGTEngine.h"
+#include "SumSearch.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// 値が等しい局面 (同値類) をまとめて探し、G + (-H) が P 局面になることを総当たりで確かめる
+// disjoint_union.md の「ゲームの等価性の実験的検証」を全局面に対して行うためのもの
+class EquivFinder {
+public:
+    struct VerifyResult {
+        uint64_t checked = 0;
+        uint64_t passed = 0;
+        std::vector<std::pair<RowPosition, RowPosition>> failures;
+    };
+
+    explicit EquivFinder(CGTEngine& engine);
+
+    // 1..max_n の空盤から到達できる全局面の値を計算し、値ごとのバケットに入れる
+    void collect(int max_n);
+
+    // 値 (GameId は標準形なのでそのまま指紋になる) -> 局面の一覧
+    const std::unordered_map<GameId, std::vector<RowPosition>>& classes() const { return buckets; }
+    size_t num_positions() const { return position_count; }
+
+    // 各同値類の代表 G と他のメンバー H について G + (-H) の帰結類が P かを並列に確認する
+    // 盤の大きさが max_n 以下の局面だけを対象にし、1クラスあたり max_pairs 組まで調べる
+    VerifyResult verify(int max_n, int max_pairs, int threads);
+
+    static std::string board_string(const RowPosition& p);
+
+private:
+    CGTEngine& engine;
+    std::unordered_map<GameId, std::vector<RowPosition>> buckets;
+    size_t position_count = 0;
+};
@@ -0,0 +1,168 @@
+#include "HeatmapGenerator.h"
+#include "MiniGoMT.h"
+#include "BitUtil.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <unordered_set>
+
+namespace {
+
+// 到達済みの局面 (色は絶対)
+struct PosKey {
+    uint64_t black, white;
+    int black_cap, white_cap, player;
+    bool operator==(const PosKey& o) const {
+        return black == o.black && white == o.white && black_cap == o.black_cap && white_cap == o.white_cap &&
+               player == o.player;
+    }
+};
+
+struct PosKeyHash {
+    size_t operator()(const PosKey& k) const {
+        uint64_t x = k.black * 0x9E3779B97F4A7C15ULL ^ k.white * 0xC2B2AE3D27D4EB4FULL;
+        x ^= (uint64_t)(k.black_cap * 131 + k.white_cap * 7 + k.player + 1) * 0x165667B19E3779F9ULL;
+        return (size_t)(x ^ (x >> 29));
+    }
+};
+
+// row の局面をマスごとに評価する
+void fill_row(MiniGoMT& engine, int n, HeatmapGenerator::Row& row) {
+    uint64_t my = (row.player == 1) ? row.black : row.white;
+    uint64_t op = (row.player == 1) ? row.white : row.black;
+    int my_cap = (row.player == 1) ? row.black_cap : row.white_cap;
+    int op_cap = (row.player == 1) ? row.white_cap : row.black_cap;
+
+    engine.set_board_size(n);
+    row.cells.assign(n, '.');
+    bool win = false;
+    for (int i = 0; i < n; ++i) {
+        if (((my | op) >> i) & 1) continue;
+        char c = engine.evaluate_move(my, op, i, my_cap, op_cap);
+        row.cells[i] = c;
+        if (c == 'g') win = true;
+    }
+    // 合法手が無いときも手番側の負け
+    row.winner = win ? row.player : -row.player;
+}
+
+} // namespace
+
+HeatmapGenerator::HeatmapGenerator(int m, int threads_, int tt_bits_)
+    : capture_target(std::max(1, std::min(m, 63))), threads(threads_), tt_bits(tt_bits_) {
+    if (threads <= 0) threads = std::max(1u, std::thread::hardware_concurrency());
+}
+
+HeatmapGenerator::Row HeatmapGenerator::first_moves(int n) {
+    // 初手は analyze_parallel が並列に解く
+    MiniGoMT engine(tt_bits);
+    engine.set_capture_target(capture_target);
+    Row row = {0, 0, 0, 0, 1, engine.analyze_parallel(n, capture_target), 0};
+    row.winner = (row.cells.find('g') != std::string::npos) ? 1 : -1;
+    return row;
+}
+
+std::vector<HeatmapGenerator::Row> HeatmapGenerator::reachable(int n) const {
+    const uint64_t full_mask = (n >= 64) ? ~0ULL : ((1ULL << n) - 1);
+    std::vector<Row> rows;
+    std::unordered_set<PosKey, PosKeyHash> seen;
+    std::vector<PosKey> stack;
+
+    PosKey root = {0, 0, 0, 0, 1};
+    seen.insert(root);
+    stack.push_back(root);
+    while (!stack.empty()) {
+        PosKey k = stack.back();
+        stack.pop_back();
+        rows.push_back({k.black, k.white, k.black_cap, k.white_cap, k.player, std::string(), 0});
+
+        uint64_t mover = (k.player == 1) ? k.black : k.white;
+        uint64_t other = (k.player == 1) ? k.white : k.black;
+        int mover_cap = (k.player == 1) ? k.black_cap : k.white_cap;
+        uint64_t empty = ~(k.black | k.white) & full_mask;
+
+        for (uint64_t e = empty; e; e &= e - 1) {
+            int idx = bitutil::lsb_index(e);
+            uint64_t move_bit = 1ULL << idx;
+            uint64_t next_empty = empty & ~move_bit;
+            uint64_t removed = 0;
+            if (idx > 0 && ((other >> (idx - 1)) & 1) && !bitutil::group_has_liberty(other, next_empty, idx - 1)) {
+                removed |= bitutil::group_mask(other, idx - 1);
+            }
+            if (idx < n - 1 && ((other >> (idx + 1)) & 1) &&
+                !bitutil::group_has_liberty(other, next_empty, idx + 1)) {
+                removed |= bitutil::group_mask(other, idx + 1);
+            }
+            if (!removed && !bitutil::group_has_liberty(mover | move_bit, next_empty, idx)) continue; // 自殺手
+
+            int next_cap = mover_cap + bitutil::popcount(removed);
+            if (next_cap >= capture_target) continue; // 終局
+
+            PosKey c = k;
+            if (k.player == 1) {
+                c.black = k.black | move_bit;
+                c.white = k.white & ~removed;
+                c.black_cap = next_cap;
+            } else {
+                c.white = k.white | move_bit;
+                c.black = k.black & ~removed;
+                c.white_cap = next_cap;
+            }
+            c.player = -k.player;
+            if (seen.insert(c).second) stack.push_back(c);
+        }
+    }
+
+    // 出力の順番を決める: 石の数 (手数) の少ない順、同じなら盤面順
+    std::sort(rows.begin(), rows.end(), [](const Row& a, const Row& b) {
+        int sa = bitutil::popcount(a.black | a.white) + a.black_cap + a.white_cap;
+        int sb = bitutil::popcount(b.black | b.white) + b.black_cap + b.white_cap;
+        if (sa != sb) return sa < sb;
+        if (a.black_cap != b.black_cap) return a.black_cap < b.black_cap;
+        if (a.white_cap != b.white_cap) return a.white_cap < b.white_cap;
+        if (a.black != b.black) return a.black < b.black;
+        return a.white < b.white;
+    });
+    return rows;
+}
+
+std::vector<HeatmapGenerator::Row> HeatmapGenerator::all_positions(int n) {
+    std::vector<Row> rows = reachable(n);
+
+    // 64 局面ずつ取りに来る (局面によって重さが違うので静的には分けない)
+    const size_t CHUNK = 64;
+    std::atomic<size_t> next{0};
+    auto worker = [&]() {
+        MiniGoMT engine(tt_bits);
+        engine.set_capture_target(capture_target);
+        for (;;) {
+            size_t begin = next.fetch_add(CHUNK);
+            if (begin >= rows.size()) break;
+            size_t end = std::min(rows.size(), begin + CHUNK);
+            for (size_t i = begin; i < end; ++i) fill_row(engine, n, rows[i]);
+        }
+    };
+
+    int t = (int)std::min<size_t>(threads, (rows.size() + CHUNK - 1) / CHUNK);
+    std::vector<std::thread> pool;
+    for (int i = 1; i < t; ++i) pool.emplace_back(worker);
+    worker();
+    for (auto& th : pool) th.join();
+    return rows;
+}
+
+void HeatmapGenerator::write_header(std::ostream& os) {
+    os << "N,Player,BlackCap,WhiteCap,Board,Cells,Winner\n";
+}
+
+void HeatmapGenerator::write_rows(std::ostream& os, int n, const std::vector<Row>& rows) {
+    std::string board(n, '0');
+    for (const Row& r : rows) {
+        for (int i = 0; i < n; ++i) {
+            board[i] = ((r.black >> i) & 1) ? '1' : ((r.white >> i) & 1) ? '-' : '0';
+        }
+        os << n << "," << r.player << "," << r.black_cap << "," << r.white_cap << "," << board << "," << r.cells
+           << "," << r.winner << "\n";
+    }
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// ヒートマップ用の「マスごとの勝ち/負け/自殺手」を C++ でまとめて作る
+// (heat-map-go/test.py の再帰ソルバや compare_N.py の行ループの代わり。Python 側は描くだけにする)
+//
+// 対象は 空の盤面だけ (初手マップ) か、初期局面から到達できる全局面
+// 全局面は左右反転を区別したまま並べる (ヒートマップはマスの位置ごとに描くので)
+// 局面はスレッドに分けて解き、スレッドごとに MiniGoMT (置換表) を1つ持つ
+class HeatmapGenerator {
+public:
+    // 1局面分の行
+    struct Row {
+        uint64_t black, white;
+        int black_cap, white_cap;
+        int player;         // 1: 黒番, -1: 白番
+        std::string cells;  // マスごとに 'g'=勝ち 'r'=負け 'x'=自殺手、石のあるマスは '.'
+        int winner;         // 最善を尽くしたときの勝者 (1: 黒, -1: 白)
+    };
+
+    // threads = 0 ならコア数。tt_bits はスレッド1つあたり
+    HeatmapGenerator(int m, int threads = 0, int tt_bits = 22);
+
+    // 空の 1xn (黒番) の1行
+    Row first_moves(int n);
+
+    // 空の 1xn から到達できる、終局していない全局面 (取った数が違えば別の局面)
+    std::vector<Row> all_positions(int n);
+
+    // N,Player,BlackCap,WhiteCap,Board,Cells,Winner
+    // Board は Solver のキーと同じ 1=黒 -=白 0=空点
+    static void write_header(std::ostream& os);
+    static void write_rows(std::ostream& os, int n, const std::vector<Row>& rows);
+
+    int thread_count() const { return threads; }
+
+private:
+    int capture_target;
+    int threads;
+    int tt_bits;
+
+    // 到達できる局面を深さ優先で集める (cells / winner はまだ空)
+    std::vector<Row> reachable(int n) const;
+};
@@ -0,0 +1,243 @@
+#include "HintServer.h"
+#include <iostream>
+#include <sstream>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+
+// 接続ごとの状態。送信はノンブロッキングで、送り切れなかった分は out に残して POLLOUT で続きを送る
+// (解析は poll のスレッドで走るので、1つのクライアントの送信で他の接続を止めない)
+struct Client {
+    int fd;
+    std::string in;   // まだ改行の来ていない受信データ
+    std::string out;  // 送り残した応答
+    bool closing = false; // QUIT を受けた (out を送り切ったら閉じる)
+};
+
+// 送れるだけ送る。接続が切れていたら false
+bool flush(Client& c) {
+    while (!c.out.empty()) {
+        ssize_t w = send(c.fd, c.out.data(), c.out.size(), MSG_NOSIGNAL);
+        if (w < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return true;
+        if (w < 0 && errno == EINTR) continue;
+        if (w <= 0) return false;
+        c.out.erase(0, (size_t)w);
+    }
+    return true;
+}
+
+} // namespace
+
+HintServer::HintServer(const std::string& path, int bits)
+    : socket_path(path), tt_bits(bits) {}
+
+HintServer::~HintServer() {
+    if (listen_fd >= 0) {
+        close(listen_fd);
+        unlink(socket_path.c_str());
+    }
+}
+
+MiniGoMT& HintServer::engine_for(int n) {
+    auto it = engines.find(n);
+    if (it == engines.end()) {
+        auto engine = std::make_unique<MiniGoMT>(tt_bits);
+        engine->set_board_size(n);
+        it = engines.emplace(n, std::move(engine)).first;
+    }
+    return *it->second;
+}
+
+bool HintServer::parse_board(const std::string& s, std::vector<int>& board) {
+    board.clear();
+    std::stringstream ss(s);
+    std::string cell;
+    while (std::getline(ss, cell, ',')) {
+        if (cell == "0") board.push_back(0);
+        else if (cell == "1") board.push_back(1);
+        else if (cell == "-1") board.push_back(-1);
+        else return false;
+    }
+    // ビットボードに載るサイズのみ
+    return !board.empty() && board.size() < 64;
+}
+
+std::string HintServer::hint_board(const std::vector<int>& board, int player) {
+    int n = (int)board.size();
+    MiniGoMT& engine = engine_for(n);
+
+    uint64_t my = 0, op = 0;
+    for (int i = 0; i < n; ++i) {
+        if (board[i] == player) my |= 1ULL << i;
+        else if (board[i] == -player) op |= 1ULL << i;
+    }
+
+    std::string hint;
+    for (int i = 0; i < n; ++i) {
+        if (i > 0) hint += ",";
+        if (board[i] != 0) {
+            hint += std::to_string(board[i]);
+        } else {
+            hint += engine.evaluate_move(my, op, i);
+        }
+    }
+    return hint;
+}
+
+int HintServer::best_move(const std::vector<int>& board, int player) {
+    // ヒント盤面から選ぶ: 勝ち手があればそれ、無ければ最初の合法手
+    std::string hint = hint_board(board, player);
+    int n = (int)board.size();
+    int fallback = -1;
+    std::stringstream ss(hint);
+    std::string cell;
+    for (int i = 0; i < n && std::getline(ss, cell, ','); ++i) {
+        if (cell == "g") return i;
+        if (cell == "r" && fallback < 0) fallback = i;
+    }
+    return fallback;
+}
+
+std::string HintServer::handle_request(const std::string& line) {
+    std::stringstream ss(line);
+    std::string cmd, board_str;
+    int player = 0;
+    ss >> cmd;
+
+    if (cmd == "STATS") {
+        return "OK cache=" + std::to_string(cache.size()) +
+               " hits=" + std::to_string(hits) +
+               " misses=" + std::to_string(misses) +
+               " engines=" + std::to_string(engines.size());
+    }
+    if (cmd != "HINT" && cmd != "BEST") {
+        return "ERR unknown command";
+    }
+
+    if (!(ss >> board_str >> player) || (player != 1 && player != -1)) {
+        return "ERR usage: " + cmd + " <board> <player>";
+    }
+    std::vector<int> board;
+    if (!parse_board(board_str, board)) {
+        return "ERR bad board";
+    }
+
+    std::string cache_key = cmd + " " + board_str + " " + std::to_string(player);
+    auto it = cache.find(cache_key);
+    if (it != cache.end()) {
+        ++hits;
+        return it->second;
+    }
+    ++misses;
+
+    std::string response;
+    if (cmd == "HINT") response = "OK " + hint_board(board, player);
+    else response = "OK " + std::to_string(best_move(board, player));
+
+    // 上限を超えたら丸ごと捨てる (エンジン側のTTは残るので再計算は軽い)
+    if (cache.size() >= max_cache_entries) cache.clear();
+    cache.emplace(cache_key, response);
+    return response;
+}
+
+int HintServer::run() {
+    listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0) {
+        std::perror("socket");
+        return 1;
+    }
+
+    sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(addr.sun_path)) {
+        std::cerr << "socket path too long: " << socket_path << "\n";
+        return 1;
+    }
+    std::strcpy(addr.sun_path, socket_path.c_str());
+    unlink(socket_path.c_str());
+
+    if (bind(listen_fd, (sockaddr*)&addr, sizeof(addr)) < 0 || listen(listen_fd, 16) < 0) {
+        std::perror("bind/listen");
+        return 1;
+    }
+    std::cout << "Listening on " << socket_path << "\n";
+
+    // fds[0] は listen 用、fds[c] は clients[c - 1]
+    std::vector<pollfd> fds = {{listen_fd, POLLIN, 0}};
+    std::vector<Client> clients;
+
+    running = true;
+    while (running) {
+        // 送り残しがある間は読まない (応答を受け取らないクライアントの分を溜め込まない)
+        for (size_t c = 0; c < clients.size(); ++c) {
+            fds[c + 1].events = clients[c].out.empty() ? POLLIN : POLLOUT;
+        }
+        if (poll(fds.data(), fds.size(), -1) < 0) {
+            if (errno == EINTR) continue;
+            std::perror("poll");
+            break;
+        }
+
+        if (fds[0].revents & POLLIN) {
+            int client = accept(listen_fd, nullptr, nullptr);
+            if (client >= 0) {
+                fcntl(client, F_SETFL, fcntl(client, F_GETFL) | O_NONBLOCK);
+                fds.push_back({client, POLLIN, 0});
+                clients.push_back({client, "", "", false});
+            }
+        }
+
+        for (size_t c = 0; c < clients.size() && running; ++c) {
+            Client& cl = clients[c];
+            short rev = fds[c + 1].revents;
+            bool drop = (rev & POLLERR) != 0;
+
+            if (!drop && (rev & POLLOUT)) drop = !flush(cl);
+
+            if (!drop && cl.out.empty() && (rev & (POLLIN | POLLHUP))) {
+                char buf[4096];
+                ssize_t len = recv(cl.fd, buf, sizeof(buf), 0);
+                if (len > 0) cl.in.append(buf, (size_t)len);
+                else if (len == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) drop = true;
+
+                // 届いている完全な行をまとめて処理し、応答もまとめて返す
+                size_t pos;
+                while (!drop && !cl.closing && (pos = cl.in.find('\n')) != std::string::npos) {
+                    std::string line = cl.in.substr(0, pos);
+                    cl.in.erase(0, pos + 1);
+                    if (!line.empty() && line.back() == '\r') line.pop_back();
+                    if (line.empty()) continue;
+
+                    if (line == "QUIT") { cl.closing = true; break; }
+                    if (line == "SHUTDOWN") { cl.closing = true; running = false; break; }
+                    cl.out += handle_request(line);
+                    cl.out += "\n";
+                }
+                // 改行が来ないまま長すぎる行は、読み続けずに切断する
+                if (cl.in.size() > MAX_LINE_BYTES) drop = true;
+                if (!drop) drop = !flush(cl);
+            }
+
+            if (drop || (cl.closing && cl.out.empty())) {
+                close(cl.fd);
+                fds.erase(fds.begin() + c + 1);
+                clients.erase(clients.begin() + c);
+                --c;
+            }
+        }
+    }
+
+    // 残っている接続を全部閉じる (送り残しは送れる分だけ送る)
+    for (Client& cl : clients) {
+        flush(cl);
+        close(cl.fd);
+    }
+    return running ? 1 : 0;
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include "MiniGoMT.h"
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// ナビゲーター/GUI 向けのヒント問い合わせサーバ (Unix ドメインソケット, POSIX専用)
+//
+// 1行1リクエストのテキストプロトコル。盤面は game_map_1xN.csv の RawBoard と同じ形式。
+//   HINT 0,1,0,-1,0 1   -> OK g,1,r,-1,x   (空点ごとに g=勝ち r=負け x=自殺手、石はそのまま)
+//   BEST 0,1,0,-1,0 1   -> OK 2            (最善手の位置。合法手が無ければ -1)
+//   STATS               -> OK cache=... engines=...
+//   QUIT / SHUTDOWN     -> 接続を閉じる / サーバを止める
+// 複数行をまとめて送れば、まとめて処理して1回で返す (バッチ問い合わせ)
+// 改行のないまま MAX_LINE_BYTES を超えて送ってきたクライアントは切断する
+class HintServer {
+public:
+    HintServer(const std::string& socket_path, int tt_bits = 22);
+    ~HintServer();
+
+    static const size_t MAX_LINE_BYTES = 4096;
+
+    // accept ループ (SHUTDOWN を受けるまで戻らない)。戻り値は終了コード
+    // SHUTDOWN を受けたら、全クライアントの接続を閉じてから戻る
+    int run();
+
+    // 1行分のリクエストを処理して応答行(改行なし)を返す
+    std::string handle_request(const std::string& line);
+
+private:
+    std::string socket_path;
+    int tt_bits;
+    int listen_fd = -1;
+    bool running = false;
+
+    // Nごとにエンジンを持つ (TTを温めたまま使い回すため)
+    std::map<int, std::unique_ptr<MiniGoMT>> engines;
+
+    // リクエスト行 -> 応答 のキャッシュ
+    std::unordered_map<std::string, std::string> cache;
+    size_t max_cache_entries = 1 << 20;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+
+    MiniGoMT& engine_for(int n);
+
+    // "0,1,-1" を盤面に変換する。失敗したら false
+    static bool parse_board(const std::string& s, std::vector<int>& board);
+
+    std::string hint_board(const std::vector<int>& board, int player);
+    int best_move(const std::vector<int>& board, int player);
+};
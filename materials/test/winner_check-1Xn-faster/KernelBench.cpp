@@ -0,0 +1,275 @@
+#include "KernelBench.h"
+#include "BitUtil.h"
+#include "MiniGo1xN.h"
+#include "MiniGoBit.h"
+#include "MiniGoMT.h"
+#include "Solver.h"
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <iomanip>
+
+// 計測結果をここに足し込んで、最適化で処理が消えないようにする
+static volatile uint64_t bench_sink = 0;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+KernelBench::Result make_result(const std::string& name, double seconds, uint64_t ops) {
+    KernelBench::Result r;
+    r.name = name;
+    r.ops = ops;
+    r.ns_per_op = (ops == 0) ? 0.0 : seconds * 1e9 / (double)ops;
+    r.ops_per_sec = (seconds <= 0.0) ? 0.0 : (double)ops / seconds;
+    return r;
+}
+
+// body(p) をコーパス全体に iterations 回かけて時間を測る
+template <class F>
+KernelBench::Result time_kernel(const std::string& name, const std::vector<KernelBench::Position>& corpus,
+                                int iterations, F body) {
+    uint64_t acc = 0;
+    auto start = Clock::now();
+    for (int it = 0; it < iterations; ++it) {
+        for (const auto& p : corpus) acc += body(p);
+    }
+    auto end = Clock::now();
+    bench_sink = bench_sink + acc;
+    double sec = std::chrono::duration<double>(end - start).count();
+    return make_result(name, sec, (uint64_t)corpus.size() * iterations);
+}
+
+uint64_t board_mask(int n) { return (n >= 64) ? ~0ULL : ((1ULL << n) - 1); }
+
+// ビットボードを MiniGo1xN の配列 (1=手番側, -1=相手, 0=空) に直す
+std::vector<int> to_vector(const KernelBench::Position& p, bool with_move) {
+    std::vector<int> b(p.n, 0);
+    for (int i = 0; i < p.n; ++i) {
+        if ((p.my >> i) & 1) b[i] = 1;
+        else if ((p.op >> i) & 1) b[i] = -1;
+    }
+    if (with_move) b[p.move] = 1;
+    return b;
+}
+
+// 取り判定で調べる連: 隣に相手の石があればその連、なければ打った石の連 (自殺手の判定)
+struct CaptureQuery {
+    uint64_t stones, empty;
+    int idx;
+};
+
+CaptureQuery capture_query(const KernelBench::Position& p) {
+    uint64_t move_bit = 1ULL << p.move;
+    uint64_t empty = ~(p.my | p.op | move_bit) & board_mask(p.n);
+    if (p.target >= 0) return {p.op, empty, p.target};
+    return {p.my | move_bit, empty, p.move};
+}
+
+} // namespace
+
+std::vector<KernelBench::Position> KernelBench::make_corpus(int count, int min_n, int max_n, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<Position> corpus;
+    corpus.reserve(count);
+    while ((int)corpus.size() < count) {
+        Position p;
+        p.n = min_n + (int)(rng() % (uint64_t)(max_n - min_n + 1));
+        p.my = p.op = 0;
+        for (int i = 0; i < p.n; ++i) {
+            int r = (int)(rng() % 10); // 空 4/10, 黒白 3/10 ずつ
+            if (r >= 7) p.my |= 1ULL << i;
+            else if (r >= 4) p.op |= 1ULL << i;
+        }
+        uint64_t empty = ~(p.my | p.op) & board_mask(p.n);
+        if (empty == 0) continue;
+
+        // 呼吸点のない連がある局面は対局中に現れないので捨てる
+        bool valid = true;
+        for (uint64_t s = p.my | p.op; s && valid; s &= s - 1) {
+            int i = bitutil::lsb_index(s);
+            uint64_t stones = ((p.my >> i) & 1) ? p.my : p.op;
+            valid = bitutil::group_has_liberty(stones, empty, i);
+        }
+        if (!valid) continue;
+
+        int k = (int)(rng() % (uint64_t)bitutil::popcount(empty));
+        uint64_t e = empty;
+        while (k-- > 0) e &= e - 1;
+        p.move = bitutil::lsb_index(e);
+
+        p.target = -1;
+        if (p.move > 0 && ((p.op >> (p.move - 1)) & 1)) p.target = p.move - 1;
+        else if (p.move < p.n - 1 && ((p.op >> (p.move + 1)) & 1)) p.target = p.move + 1;
+        corpus.push_back(p);
+    }
+    return corpus;
+}
+
+std::vector<KernelBench::Result> KernelBench::run_kernels(const std::vector<Position>& corpus, int iterations) {
+    std::vector<Result> results;
+
+    MiniGoBit bit(64, 10);
+    MiniGoMT mt(10);
+    // 盤の大きさは局面ごとに直接書き換える (set_board_size は N が変わるたびに TT をクリアするため)
+    auto set_size = [](auto& engine, int n) {
+        engine.n_size = n;
+        engine.full_mask = board_mask(n);
+    };
+
+    std::vector<std::vector<int>> before, after;
+    std::vector<MiniGo1xN> games;
+    before.reserve(corpus.size());
+    after.reserve(corpus.size());
+    games.reserve(corpus.size());
+    for (const auto& p : corpus) {
+        before.push_back(to_vector(p, false));
+        after.push_back(to_vector(p, true));
+        games.emplace_back(before.back(), 1);
+    }
+    // 配列版のカーネルは局面の番号で引く
+    auto index_of = [&](const Position& p) { return (size_t)(&p - corpus.data()); };
+
+    // --- 取り判定 (石を置いた後、隣の相手の連または自分の連に呼吸点が残るか) ---
+    results.push_back(time_kernel("is_captured/MiniGoBit_loop", corpus, iterations, [&](const Position& p) {
+        set_size(bit, p.n);
+        CaptureQuery q = capture_query(p);
+        return (uint64_t)bit.is_captured(q.stones, q.empty, 1ULL << q.idx);
+    }));
+    results.push_back(time_kernel("is_captured/MiniGoMT_bitscan", corpus, iterations, [&](const Position& p) {
+        set_size(mt, p.n);
+        CaptureQuery q = capture_query(p);
+        return (uint64_t)mt.is_captured(q.stones, q.empty, 1ULL << q.idx);
+    }));
+    results.push_back(time_kernel("is_captured/bitutil_group_mask", corpus, iterations, [&](const Position& p) {
+        CaptureQuery q = capture_query(p);
+        return (uint64_t)!bitutil::group_has_liberty(q.stones, q.empty, q.idx);
+    }));
+    results.push_back(time_kernel("is_captured/MiniGo1xN_vector", corpus, iterations, [&](const Position& p) {
+        const auto& b = after[index_of(p)];
+        const MiniGo1xN& g = games[index_of(p)];
+        if (p.target >= 0) return (uint64_t)(g.count_liberties(p.target, -1, b) == 0);
+        return (uint64_t)(g.count_liberties(p.move, 1, b) == 0);
+    }));
+
+    // --- ハッシュ (左右反転の正規化込み) ---
+    results.push_back(time_kernel("compute_hash/MiniGoBit", corpus, iterations, [&](const Position& p) {
+        set_size(bit, p.n);
+        return bit.compute_hash(p.my, p.op);
+    }));
+    results.push_back(time_kernel("compute_hash/MiniGoMT", corpus, iterations, [&](const Position& p) {
+        set_size(mt, p.n);
+        return mt.compute_hash(p.my, p.op);
+    }));
+    {
+        Solver solver;
+        results.push_back(time_kernel("compute_hash/Solver_vector", corpus, iterations, [&](const Position& p) {
+            return (uint64_t)solver.compute_hash(before[index_of(p)], 1);
+        }));
+    }
+
+    // --- 合法手生成 ---
+    results.push_back(time_kernel("movegen/MiniGo1xN_vector", corpus, iterations, [&](const Position& p) {
+        return (uint64_t)games[index_of(p)].get_legal_moves().size();
+    }));
+    results.push_back(time_kernel("movegen/bitutil_try_move", corpus, iterations, [&](const Position& p) {
+        uint64_t legal = 0;
+        for (uint64_t e = ~(p.my | p.op) & board_mask(p.n); e; e &= e - 1) {
+            int i = bitutil::lsb_index(e);
+            if (bitutil::try_move(p.my, p.op, i, p.n) != bitutil::MOVE_ILLEGAL) legal |= 1ULL << i;
+        }
+        return legal;
+    }));
+
+    // --- 着手 (配列版は盤面のコピーを作る。ビットボード版は2語なので戻すのは元の値を使うだけ) ---
+    results.push_back(time_kernel("make/MiniGo1xN_copy", corpus, iterations, [&](const Position& p) {
+        auto next = games[index_of(p)].make_move(p.move);
+        return (uint64_t)next.second + (uint64_t)next.first.board[p.move];
+    }));
+    results.push_back(time_kernel("make/bitboard", corpus, iterations, [&](const Position& p) {
+        uint64_t move_bit = 1ULL << p.move;
+        uint64_t next_my = p.my | move_bit;
+        uint64_t next_op = p.op;
+        uint64_t empty = ~(next_my | next_op) & board_mask(p.n);
+        for (int adj : {p.move - 1, p.move + 1}) {
+            if (adj < 0 || adj >= p.n || !((next_op >> adj) & 1)) continue;
+            if (!bitutil::group_has_liberty(next_op, empty, adj)) next_op &= ~bitutil::group_mask(next_op, adj);
+        }
+        return next_my ^ (next_op << 1);
+    }));
+
+    return results;
+}
+
+std::vector<KernelBench::Result> KernelBench::run_solvers(int n) {
+    std::vector<Result> results;
+
+    // 配列版 Solver: 初手ごとに solve してノード数を合計する (analyze_initial_moves と同じ手順)
+    {
+        Solver solver;
+        uint64_t nodes = 0;
+        MiniGo1xN game(std::vector<int>(n, 0), 1);
+        auto start = Clock::now();
+        for (int move : game.get_legal_moves()) {
+            auto next = game.make_move(move);
+            if (next.second) continue;
+            bench_sink = bench_sink + (uint64_t)solver.solve(next.first.board, next.first.player);
+            nodes += solver.get_node_count();
+        }
+        double sec = std::chrono::duration<double>(Clock::now() - start).count();
+        results.push_back(make_result("solve/Solver_nodes_N" + std::to_string(n), sec, nodes));
+    }
+
+    // ビットボード版も初手解析全体で訪れた局面数を ops にする
+    {
+        MiniGoBit bit(64, 22);
+        auto start = Clock::now();
+        bench_sink = bench_sink + bit.analyze(n).size();
+        double sec = std::chrono::duration<double>(Clock::now() - start).count();
+        results.push_back(make_result("solve/MiniGoBit_nodes_N" + std::to_string(n), sec, bit.get_node_count()));
+    }
+    {
+        // 並列版はスレッドごとのカウンタの合計 (ProgressReporter が読むのと同じ値)
+        MiniGoMT mt(22);
+        auto start = Clock::now();
+        bench_sink = bench_sink + mt.analyze_parallel(n).size();
+        double sec = std::chrono::duration<double>(Clock::now() - start).count();
+        results.push_back(make_result("solve/MiniGoMT_nodes_N" + std::to_string(n), sec, mt.get_progress().nodes));
+    }
+    return results;
+}
+
+std::string KernelBench::to_json(const std::vector<Result>& results, const std::string& label) {
+    // load_baseline で行ごとに読めるよう、1結果1行で書く
+    std::ostringstream os;
+    os << std::setprecision(6);
+    os << "{\n  \"label\": \"" << label << "\",\n  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        os << "    {\"name\": \"" << r.name << "\", \"ns_per_op\": " << r.ns_per_op
+           << ", \"ops_per_sec\": " << r.ops_per_sec << ", \"ops\": " << r.ops << "}"
+           << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    os << "  ]\n}\n";
+    return os.str();
+}
+
+std::vector<std::pair<std::string, double>> KernelBench::load_baseline(const std::string& path) {
+    std::vector<std::pair<std::string, double>> baseline;
+    std::ifstream ifs(path);
+    std::string line;
+    const std::string name_key = "\"name\": \"";
+    const std::string ns_key = "\"ns_per_op\": ";
+    while (std::getline(ifs, line)) {
+        size_t a = line.find(name_key);
+        size_t b = line.find(ns_key);
+        if (a == std::string::npos || b == std::string::npos) continue;
+        a += name_key.size();
+        size_t a_end = line.find('"', a);
+        if (a_end == std::string::npos) continue;
+        baseline.emplace_back(line.substr(a, a_end - a), std::atof(line.c_str() + b + ns_key.size()));
+    }
+    return baseline;
+}
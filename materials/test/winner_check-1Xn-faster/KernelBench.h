@@ -0,0 +1,37 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// 探索の中心になる小さな処理 (取り判定・ハッシュ・合法手生成・着手) をエンジンごとに計測する
+// 各エンジンの private 関数を直接呼ぶので、対象クラスは KernelBench を friend にしている
+class KernelBench {
+public:
+    struct Position {
+        int n;
+        uint64_t my, op; // 手番側/相手 (ビット i = マス i)
+        int move;        // 空点 (着手・取り判定に使う)
+        int target;      // move の隣にある相手の石 (なければ -1)
+    };
+
+    struct Result {
+        std::string name;
+        double ns_per_op;
+        double ops_per_sec;
+        uint64_t ops;
+    };
+
+    // N が min_n..max_n のランダムな局面 (呼吸点のない連を含まない) を count 個作る
+    static std::vector<Position> make_corpus(int count, int min_n, int max_n, uint64_t seed);
+
+    // 全カーネルを計測する。iterations: コーパスを何周するか
+    static std::vector<Result> run_kernels(const std::vector<Position>& corpus, int iterations);
+
+    // 探索全体 (1xN 初手解析) を計測し、nodes/sec を出す
+    static std::vector<Result> run_solvers(int n);
+
+    static std::string to_json(const std::vector<Result>& results, const std::string& label);
+
+    // to_json で書いたファイルから name -> ns_per_op を読む (見つからなければ空)
+    static std::vector<std::pair<std::string, double>> load_baseline(const std::string& path);
+};
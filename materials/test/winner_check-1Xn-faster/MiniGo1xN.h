@@ -14,6 +14,8 @@ public:
       bool would_be_suicide(int pos) const;
     
 private:
+    friend class KernelBench; // 計測用 (KernelBench.h)
+
     bool is_capture(int pos, int current_player) const;
   
     // 修正: グループ（連）を考慮して呼吸点を数える
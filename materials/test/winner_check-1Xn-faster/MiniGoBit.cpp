@@ -1,13 +1,15 @@
 #include "MiniGoBit.h"
+#include "BitUtil.h"
+#include "SearchStats.h"
 #include <algorithm>
 #include <random>
 #include <cstring>
 
 // コンストラクタ: TTとZobristの初期化
-MiniGoBit::MiniGoBit(int max_n_size) {
+MiniGoBit::MiniGoBit(int max_n_size, int tt_bits) {
     // 置換表のサイズ: 2^24 = 約1677万エントリ (約256MB)
     // Nが大きくなると衝突が増えるため、メモリが許す限り大きくする
-    tt.resize(1 << 27); 
+    tt.resize(1ULL << tt_bits);
     init_zobrist();
 }
 
@@ -18,6 +20,10 @@ void MiniGoBit::init_zobrist() {
         zobrist_op[i] = rng();
     }
     zobrist_turn = rng();
+    for (int i = 0; i < 64; ++i) {
+        zobrist_cap_my[i] = (i == 0) ? 0 : rng();
+        zobrist_cap_op[i] = (i == 0) ? 0 : rng();
+    }
 }
 
 void MiniGoBit::clear_tt() {
@@ -81,10 +87,12 @@ bool MiniGoBit::is_captured(uint64_t stones, uint64_t empty, uint64_t start_bit)
 // ---------------------------------------------------------
 // analyze 関数を修正 (探索順序の生成を追加)
 // ---------------------------------------------------------
-std::string MiniGoBit::analyze(int n) {
+std::string MiniGoBit::analyze(int n, int m) {
     n_size = n;
     full_mask = (1ULL << n) - 1;
+    capture_target = std::max(1, std::min(m, 63));
     clear_tt();
+    node_count = 0;
 
     // ★追加: 中央から外側に向かう探索順序を生成
     move_order.clear();
@@ -114,7 +122,7 @@ std::string MiniGoBit::analyze(int n) {
         }
 
         // 探索呼び出し
-        int score = -solve(op, my, -1, 1, 1);
+        int score = -solve(op, my, 0, 0, -1, 1, 1);
         
         if (score == 1) result += "g"; 
         else result += "r";            
@@ -125,11 +133,14 @@ std::string MiniGoBit::analyze(int n) {
 // ---------------------------------------------------------
 // solve 関数を修正 (ビットスキャンをやめて move_order ループへ)
 // ---------------------------------------------------------
-int MiniGoBit::solve(uint64_t my, uint64_t op, int alpha, int beta, int depth) {
-    // 1. 置換表参照 (変更なし)
-    uint64_t key = compute_hash(my, op);
+int MiniGoBit::solve(uint64_t my, uint64_t op, int my_cap, int op_cap, int alpha, int beta, int depth) {
+    // 1. 置換表参照 (取った石の数もキーに含める)
+    node_count++;
+    MINIGO_STAT(SearchStats::local().node(depth));
+    uint64_t key = compute_hash(my, op) ^ zobrist_cap_my[my_cap] ^ zobrist_cap_op[op_cap];
     size_t idx = key & (tt.size() - 1);
     
+    MINIGO_STAT(SearchStats::local().probe(tt[idx], key));
     if (tt[idx].flag && tt[idx].key == key) {
         return tt[idx].score;
     }
@@ -139,6 +150,7 @@ int MiniGoBit::solve(uint64_t my, uint64_t op, int alpha, int beta, int depth) {
 
     bool can_move = false;
     int max_val = -2; 
+    int rank = 0; // 何番目に調べた空点か (統計用)
 
     // ★修正: while(temp_empty) をやめて、move_order でループする
     // これにより「中央付近」から優先的に探索される
@@ -149,41 +161,48 @@ int MiniGoBit::solve(uint64_t my, uint64_t op, int alpha, int beta, int depth) {
         if (!((empty >> move_idx) & 1)) {
             continue;
         }
+        ++rank;
 
         // --- 以下、以前のロジックと同じ ---
         
         uint64_t next_my = my | move_bit;
-        bool captured = false;
+        uint64_t removed = 0;
         
         // 左隣
         if ((move_idx > 0) && ((op >> (move_idx - 1)) & 1)) {
             if (is_captured(op, empty & ~move_bit, 1ULL << (move_idx - 1))) {
-                captured = true;
+                removed |= bitutil::group_mask(op, move_idx - 1);
             }
         }
         // 右隣
-        if (!captured && (move_idx < n_size - 1) && ((op >> (move_idx + 1)) & 1)) {
+        if ((move_idx < n_size - 1) && ((op >> (move_idx + 1)) & 1)) {
             if (is_captured(op, empty & ~move_bit, 1ULL << (move_idx + 1))) {
-                captured = true;
+                removed |= bitutil::group_mask(op, move_idx + 1);
             }
         }
 
-        if (captured) {
-            tt[idx] = {key, 1, 1};
+        // 取った数が m に届いたら勝ち。届かなければ連を盤から除いて続行
+        int next_cap = my_cap + bitutil::popcount(removed);
+        if (next_cap >= capture_target) {
+            MINIGO_STAT(SearchStats::local().capture_win());
+            MINIGO_STAT(SearchStats::local().store(tt[idx], key));
+            tt[idx] = {key, 1, 1, (uint8_t)std::min(depth, 255)};
             return 1;
         }
 
-        if (is_captured(next_my, empty & ~move_bit, move_bit)) {
+        if (!removed && is_captured(next_my, empty & ~move_bit, move_bit)) {
             continue; 
         }
 
         can_move = true;
-        int score = -solve(op, next_my, -beta, -alpha, depth + 1);
+        int score = -solve(op & ~removed, next_my, op_cap, next_cap, -beta, -alpha, depth + 1);
 
         if (score > max_val) {
             max_val = score;
             if (score >= beta) {
-                tt[idx] = {key, (int16_t)score, 1};
+                MINIGO_STAT(SearchStats::local().cutoff(rank - 1, SearchStats::move_class(my, op, move_bit)));
+                MINIGO_STAT(SearchStats::local().store(tt[idx], key));
+                tt[idx] = {key, (int16_t)score, 1, (uint8_t)std::min(depth, 255)};
                 return score;
             }
             if (score > alpha) {
@@ -194,10 +213,12 @@ int MiniGoBit::solve(uint64_t my, uint64_t op, int alpha, int beta, int depth) {
     // ループ終了
 
     if (!can_move) {
-        tt[idx] = {key, -1, 1};
+        MINIGO_STAT(SearchStats::local().store(tt[idx], key));
+        tt[idx] = {key, -1, 1, (uint8_t)std::min(depth, 255)};
         return -1;
     }
 
-    tt[idx] = {key, (int16_t)max_val, 1};
+    MINIGO_STAT(SearchStats::local().store(tt[idx], key));
+    tt[idx] = {key, (int16_t)max_val, 1, (uint8_t)std::min(depth, 255)};
     return max_val;
 }
\ No newline at end of file
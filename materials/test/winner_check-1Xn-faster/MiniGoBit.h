@@ -3,38 +3,42 @@
 #include <vector>
 #include <string>
 #include <iostream>
-
-// 置換表のエントリ
-struct TTEntry {
-    uint64_t key; // ハッシュキー (盤面ID)
-    int16_t score; // 評価値
-    uint8_t flag;  // 0:Empty, 1:Valid
-};
+#include "TTEntry.h"
 
 class MiniGoBit {
 public:
-    MiniGoBit(int max_n_size = 64);
+    // tt_bits: 置換表のエントリ数 2^tt_bits (27 = 2GB)
+    MiniGoBit(int max_n_size = 64, int tt_bits = 27);
 
     // 指定されたNについて、初手の評価値を文字列で返す (例: "rgrxg...")
-    std::string analyze(int n);
+    // m: 先に m 個取った方が勝ち (1..63)
+    std::string analyze(int n, int m = 1);
+
+    // 直前の analyze で訪れた局面数
+    size_t get_node_count() const { return node_count; }
 
 private:
+    friend class KernelBench; // 計測用 (KernelBench.h)
+
     int n_size;
     uint64_t full_mask; // N個のビットが立ったマスク
+    int capture_target = 1; // 勝利条件 m
 
     // --- Transposition Table ---
     std::vector<TTEntry> tt;
     uint64_t zobrist_my[64];
     uint64_t zobrist_op[64];
     uint64_t zobrist_turn; // 手番用
+    uint64_t zobrist_cap_my[64]; // 取った石の数 (0 のときは 0)
+    uint64_t zobrist_cap_op[64];
 
     void init_zobrist();
     void clear_tt();
     
     // --- Core Logic ---
     // alpha-beta探索
-    // my: 手番の石, op: 相手の石
-    int solve(uint64_t my, uint64_t op, int alpha, int beta, int depth);
+    // my: 手番の石, op: 相手の石, my_cap/op_cap: それぞれが取った石の数
+    int solve(uint64_t my, uint64_t op, int my_cap, int op_cap, int alpha, int beta, int depth);
 
     // グループの呼吸点が0かどうか判定する
     // stones: 対象の色の石全体, empty: 空点のビット
@@ -46,4 +50,6 @@ private:
 
     // private メンバに追加してください
     std::vector<int> move_order;
+
+    size_t node_count = 0;
 };
\ No newline at end of file
@@ -0,0 +1,117 @@
+#include "MiniGoCAPI.h"
+#include "MiniGoMT.h"
+#include "BitUtil.h"
+#include <cstring>
+#include <new>
+#include <string>
+
+struct minigo_engine {
+    MiniGoMT mt;
+    explicit minigo_engine(int tt_bits) : mt(tt_bits) {}
+};
+
+namespace {
+
+// 盤面を手番側/相手側のビットボードにする。値が 0/1/-1 以外、または呼吸点のない連があれば false
+bool to_bits(const int8_t* board, int n, int player, uint64_t& my, uint64_t& op) {
+    my = op = 0;
+    for (int i = 0; i < n; ++i) {
+        if (board[i] == player) my |= 1ULL << i;
+        else if (board[i] == -player) op |= 1ULL << i;
+        else if (board[i] != 0) return false;
+    }
+    uint64_t full_mask = (1ULL << n) - 1;
+    uint64_t empty = ~(my | op) & full_mask;
+    for (int i = 0; i < n; ++i) {
+        if (((my >> i) & 1) && !bitutil::group_has_liberty(my, empty, i)) return false;
+        if (((op >> i) & 1) && !bitutil::group_has_liberty(op, empty, i)) return false;
+    }
+    return true;
+}
+
+bool valid_args(minigo_engine* engine, const int8_t* board, int n, int player, int black_cap, int white_cap) {
+    if (!engine || !board || n < 1 || n > 63 || (player != 1 && player != -1)) return false;
+    // m 個取った局面はもう終局している
+    int m = engine->mt.get_capture_target();
+    return black_cap >= 0 && white_cap >= 0 && black_cap < m && white_cap < m;
+}
+
+} // namespace
+
+minigo_engine* minigo_create(int tt_bits) {
+    if (tt_bits < 10 || tt_bits > 32) return nullptr;
+    try {
+        return new minigo_engine(tt_bits);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void minigo_destroy(minigo_engine* engine) {
+    delete engine;
+}
+
+int minigo_set_capture_target(minigo_engine* engine, int m) {
+    if (!engine || m < 1 || m > 63) return MINIGO_INVALID;
+    engine->mt.set_capture_target(m);
+    return 1;
+}
+
+int minigo_solve(minigo_engine* engine, const int8_t* board, int n, int player, int black_cap, int white_cap) {
+    if (!valid_args(engine, board, n, player, black_cap, white_cap)) return MINIGO_INVALID;
+    uint64_t my, op;
+    if (!to_bits(board, n, player, my, op)) return MINIGO_INVALID;
+    int my_cap = (player == 1) ? black_cap : white_cap;
+    int op_cap = (player == 1) ? white_cap : black_cap;
+    try {
+        engine->mt.set_board_size(n);
+        return engine->mt.solve_position(my, op, my_cap, op_cap);
+    } catch (...) {
+        return MINIGO_INVALID;
+    }
+}
+
+int minigo_hint(minigo_engine* engine, const int8_t* board, int n, int player, int black_cap, int white_cap,
+                char* out) {
+    if (!out || !valid_args(engine, board, n, player, black_cap, white_cap)) return MINIGO_INVALID;
+    uint64_t my, op;
+    if (!to_bits(board, n, player, my, op)) return MINIGO_INVALID;
+    int my_cap = (player == 1) ? black_cap : white_cap;
+    int op_cap = (player == 1) ? white_cap : black_cap;
+    try {
+        engine->mt.set_board_size(n);
+        for (int i = 0; i < n; ++i) {
+            out[i] = (board[i] != 0) ? '.' : engine->mt.evaluate_move(my, op, i, my_cap, op_cap);
+        }
+        return 1;
+    } catch (...) {
+        return MINIGO_INVALID;
+    }
+}
+
+int minigo_analyze(minigo_engine* engine, int n, int m, char* out, int out_len) {
+    if (!engine || !out || n < 1 || n > 63 || m < 1 || m > 63 || out_len < n + 1) return MINIGO_INVALID;
+    try {
+        engine->mt.set_capture_target(m);
+        std::string res = engine->mt.analyze_parallel(n, m);
+        std::memcpy(out, res.data(), res.size());
+        out[res.size()] = '\0';
+        return 1;
+    } catch (...) {
+        return MINIGO_INVALID;
+    }
+}
+
+int minigo_solve_batch(minigo_engine* engine, const int8_t* boards, int count, int n, const int8_t* players,
+                       const int8_t* caps, int8_t* out) {
+    if (!engine || !boards || !players || !out || count < 0) return 0;
+    int solved = 0;
+    for (int k = 0; k < count; ++k) {
+        int black_cap = caps ? caps[2 * k] : 0;
+        int white_cap = caps ? caps[2 * k + 1] : 0;
+        int r = minigo_solve(engine, boards + (size_t)k * n, n, players[k], black_cap, white_cap);
+        out[k] = (int8_t)r;
+        if (r != MINIGO_INVALID) ++solved;
+    }
+    return solved;
+}
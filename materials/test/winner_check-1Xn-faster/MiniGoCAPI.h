@@ -0,0 +1,55 @@
+#pragma once
+#include <stdint.h>
+
+// MiniGoMT を Python (ctypes) などから呼ぶための C の API (共有ライブラリ libminigo.so / minigo.dll)
+//
+// 盤面は HintServer / game_map_1xN.csv の RawBoard と同じ int8 の配列 (0: 空点, 1: 黒, -1: 白)、
+// 手番 player は 1 (黒) / -1 (白)。取った数は black_cap / white_cap (m 個取ったら勝ち)。
+// 結果は手番側から見て 1=勝ち, -1=負け。入力がおかしいときは MINIGO_INVALID (0) を返す
+//
+// エンジン1つは置換表を1つ持つ。同じエンジンを複数のスレッドから同時に使わないこと
+// (スレッドごとにエンジンを作る)。呼び出し中に C++ の例外が外へ出ることはない
+
+#if defined(_WIN32)
+#define MINIGO_API __declspec(dllexport)
+#else
+#define MINIGO_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MINIGO_INVALID 0
+
+typedef struct minigo_engine minigo_engine;
+
+// tt_bits: 置換表 2^tt_bits エントリ (16 バイト/エントリ)。失敗したら NULL
+MINIGO_API minigo_engine* minigo_create(int tt_bits);
+MINIGO_API void minigo_destroy(minigo_engine* engine);
+
+// 勝利条件 m (1..63)。変わったときだけ置換表をクリアする。成功で 1
+MINIGO_API int minigo_set_capture_target(minigo_engine* engine, int m);
+
+// 局面を解く (盤の大きさ n は 1..63)
+MINIGO_API int minigo_solve(minigo_engine* engine, const int8_t* board, int n, int player, int black_cap,
+                            int white_cap);
+
+// 空点ごとの評価を out[0..n) に書く: 'g'=勝ち 'r'=負け 'x'=自殺手、石のあるマスは '.'
+// 成功で 1
+MINIGO_API int minigo_hint(minigo_engine* engine, const int8_t* board, int n, int player, int black_cap,
+                           int white_cap, char* out);
+
+// 空の 1xn の初手マップ ('g'/'r'/'x' の n 文字) を out に書く。out_len は終端の 0 を含めて n+1 以上
+// 初手を並列に解く (analyze_parallel)。成功で 1
+MINIGO_API int minigo_analyze(minigo_engine* engine, int n, int m, char* out, int out_len);
+
+// count 個の局面をまとめて解き、out[i] (int8) に 1 / -1 / MINIGO_INVALID を書く
+// boards: count x n の行優先配列、players: count 個、caps: count x 2 (黒, 白) または NULL (全部 0)
+// 戻り値は解けた局面の数
+MINIGO_API int minigo_solve_batch(minigo_engine* engine, const int8_t* boards, int count, int n,
+                                  const int8_t* players, const int8_t* caps, int8_t* out);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,364 @@
+#include "MiniGoMCTS.h"
+#include "BitUtil.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+namespace {
+
+// UCT の探索項と RAVE のバイアス (b)
+const double UCT_C = 0.4;
+const double RAVE_B = 0.1;
+
+} // namespace
+
+MiniGoMCTS::MiniGoMCTS(size_t max_nodes, int threads)
+    : capacity(std::max<size_t>(max_nodes, 1)), nodes(new Node[std::max<size_t>(max_nodes, 1)]) {
+    num_threads = (threads > 0) ? threads : std::max(1u, std::thread::hardware_concurrency());
+}
+
+void MiniGoMCTS::set_board_size(int n) {
+    n_size = n;
+    full_mask = (n >= 64) ? ~0ULL : ((1ULL << n) - 1);
+}
+
+void MiniGoMCTS::set_capture_target(int m) {
+    capture_target = std::max(1, std::min(m, 63));
+}
+
+bool MiniGoMCTS::apply_move(uint64_t my, uint64_t op, uint64_t empty, int idx, uint64_t& removed) const {
+    uint64_t next_empty = empty & ~(1ULL << idx);
+    removed = 0;
+    if (idx > 0 && ((op >> (idx - 1)) & 1) && !bitutil::group_has_liberty(op, next_empty, idx - 1)) {
+        removed |= bitutil::group_mask(op, idx - 1);
+    }
+    if (idx < n_size - 1 && ((op >> (idx + 1)) & 1) && !bitutil::group_has_liberty(op, next_empty, idx + 1)) {
+        removed |= bitutil::group_mask(op, idx + 1);
+    }
+    // 取れない手は、置いた石の連に呼吸点がなければ自殺手
+    return removed || bitutil::group_has_liberty(my | (1ULL << idx), next_empty, idx);
+}
+
+// candidates から一様に1マス選ぶ。まず数回だけ当てずっぽうに引き、外れたら k 番目のビットを数えて取る
+int MiniGoMCTS::pick(uint64_t candidates, Rng& rng) const {
+    for (int t = 0; t < 3; ++t) {
+        int r = rng.below(n_size);
+        if ((candidates >> r) & 1) return r;
+    }
+    int k = rng.below(bitutil::popcount(candidates));
+    while (k-- > 0) candidates &= candidates - 1;
+    return bitutil::lsb_index(candidates);
+}
+
+int MiniGoMCTS::playout(uint64_t my, uint64_t op, int my_cap, int op_cap, int color, Rng& rng,
+                        uint64_t played[2]) const {
+    uint64_t empty = ~(my | op) & full_mask;
+    uint64_t candidates = empty;
+    while (true) {
+        if (candidates == 0) return color ^ 1; // 打つ手がない側の負け
+        // 取れる手があれば必ず取る (m=1 ならその場で勝ち)。取る手は自殺手にならない
+        uint64_t captures = bitutil::capture_points(op, empty);
+        if (captures && capture_target == 1) {
+            played[color] |= captures & (0 - captures);
+            return color;
+        }
+        int idx = captures ? pick(captures, rng) : pick(candidates, rng);
+        uint64_t removed;
+        if (!apply_move(my, op, empty, idx, removed)) {
+            candidates &= ~(1ULL << idx);
+            continue;
+        }
+        // 相手があと1個で勝つなら、取られる形 (呼吸点1つの連) を作る手も引き直す。
+        // 残りが全部そうなら次の手で取られて負け
+        if (!removed && op_cap + 1 >= capture_target) {
+            uint64_t after = my | (1ULL << idx);
+            if (bitutil::capture_points(after, empty & ~(1ULL << idx))) {
+                candidates &= ~(1ULL << idx);
+                continue;
+            }
+        }
+        played[color] |= 1ULL << idx;
+        if (removed) {
+            my_cap += bitutil::popcount(removed);
+            if (my_cap >= capture_target) return color;
+            op &= ~removed;
+        }
+        my |= 1ULL << idx;
+
+        // 手番交代
+        std::swap(my, op);
+        std::swap(my_cap, op_cap);
+        color ^= 1;
+        empty = ~(my | op) & full_mask;
+        candidates = empty;
+    }
+}
+
+void MiniGoMCTS::init_node(Node& node, uint64_t my, uint64_t op, int my_cap, int op_cap, int move) {
+    node.my = my;
+    node.op = op;
+    node.my_cap = (int16_t)my_cap;
+    node.op_cap = (int16_t)op_cap;
+    node.move = (int8_t)move;
+    node.result.store(0, std::memory_order_relaxed);
+    node.state.store(0, std::memory_order_relaxed);
+    node.num_children = 0;
+    node.first_child = 0;
+    node.visits.store(0, std::memory_order_relaxed);
+    node.wins.store(0, std::memory_order_relaxed);
+    node.amaf_visits.store(0, std::memory_order_relaxed);
+    node.amaf_wins.store(0, std::memory_order_relaxed);
+}
+
+void MiniGoMCTS::reset_tree(uint64_t my, uint64_t op, int my_cap, int op_cap) {
+    used.store(1, std::memory_order_relaxed);
+    init_node(nodes[0], my, op, my_cap, op_cap, -1);
+}
+
+// 葉を展開する (state を 0->1 にできたスレッドだけが呼ぶ)
+void MiniGoMCTS::expand(uint32_t index) {
+    Node& node = nodes[index];
+    uint64_t empty = ~(node.my | node.op) & full_mask;
+
+    struct Move {
+        int idx;
+        uint64_t removed;
+    };
+    Move moves[64];
+    int count = 0;
+    for (uint64_t e = empty; e; e &= e - 1) {
+        int idx = bitutil::lsb_index(e);
+        uint64_t removed;
+        if (!apply_move(node.my, node.op, empty, idx, removed)) continue;
+        if (removed && node.my_cap + bitutil::popcount(removed) >= capture_target) {
+            // m 個目を取れる: この局面は手番側の勝ちで確定
+            node.result.store(1, std::memory_order_relaxed);
+            node.state.store(2, std::memory_order_release);
+            return;
+        }
+        moves[count++] = {idx, removed};
+    }
+    if (count == 0) {
+        node.result.store(-1, std::memory_order_relaxed);
+        node.state.store(2, std::memory_order_release);
+        return;
+    }
+
+    size_t first = used.fetch_add(count, std::memory_order_relaxed);
+    if (first + count > capacity) {
+        // 木が一杯: 展開せずに葉のまま (以後はプレイアウトだけ)
+        node.state.store(3, std::memory_order_release);
+        return;
+    }
+    for (int i = 0; i < count; ++i) {
+        const Move& mv = moves[i];
+        int cap = node.my_cap + bitutil::popcount(mv.removed);
+        init_node(nodes[first + i], node.op & ~mv.removed, node.my | (1ULL << mv.idx), node.op_cap, cap, mv.idx);
+    }
+    node.first_child = (uint32_t)first;
+    node.num_children = (uint8_t)count;
+    node.state.store(2, std::memory_order_release);
+}
+
+uint32_t MiniGoMCTS::select_child(const Node& parent) const {
+    double log_n = std::log((double)std::max<uint32_t>(parent.visits.load(std::memory_order_relaxed), 1));
+    uint32_t best = parent.first_child;
+    double best_score = -1e300;
+    for (uint32_t i = parent.first_child; i < parent.first_child + parent.num_children; ++i) {
+        const Node& c = nodes[i];
+        int r = c.result.load(std::memory_order_relaxed);
+        if (r < 0) return i;        // 相手の負けが確定している手
+        if (r > 0) continue;        // 相手の勝ちが確定している手は選ばない (全部そうなら最初の子)
+
+        double n = c.visits.load(std::memory_order_relaxed);
+        double w = c.wins.load(std::memory_order_relaxed);
+        double an = c.amaf_visits.load(std::memory_order_relaxed);
+        double aw = c.amaf_wins.load(std::memory_order_relaxed);
+
+        double score;
+        if (n == 0) {
+            // 未訪問: AMAF があればそれ、なければ最優先
+            score = (an > 0) ? 1.0 + aw / an : 2.0;
+        } else {
+            double q = w / n;
+            double beta = (an > 0) ? an / (n + an + 4.0 * RAVE_B * RAVE_B * n * an) : 0.0;
+            double amaf = (an > 0) ? aw / an : 0.0;
+            score = (1.0 - beta) * q + beta * amaf + UCT_C * std::sqrt(log_n / n);
+        }
+        if (score > best_score) {
+            best_score = score;
+            best = i;
+        }
+    }
+    return best;
+}
+
+// 子の確定結果から親を確定させる: 負けの子が1つでもあれば勝ち、全部勝ちの子なら負け
+void MiniGoMCTS::update_proven(Node& parent) {
+    if (parent.state.load(std::memory_order_acquire) != 2 || parent.num_children == 0) return;
+    bool all_win = true;
+    for (uint32_t i = parent.first_child; i < parent.first_child + parent.num_children; ++i) {
+        int r = nodes[i].result.load(std::memory_order_relaxed);
+        if (r < 0) {
+            parent.result.store(1, std::memory_order_relaxed);
+            return;
+        }
+        if (r == 0) all_win = false;
+    }
+    if (all_win) parent.result.store(-1, std::memory_order_relaxed);
+}
+
+void MiniGoMCTS::simulate(Rng& rng) {
+    // 根の手番側の色を 0 とする。深さ d の局面の手番側は d % 2
+    uint32_t path[128];
+    int len = 0;
+    uint32_t index = 0;
+    nodes[0].visits.fetch_add(1, std::memory_order_relaxed);
+    path[len++] = 0;
+
+    while (true) {
+        Node& node = nodes[index];
+        if (node.result.load(std::memory_order_relaxed) != 0) break;
+        uint8_t st = node.state.load(std::memory_order_acquire);
+        if (st == 0) {
+            if (node.visits.load(std::memory_order_relaxed) < EXPAND_VISITS) break;
+            uint8_t expected = 0;
+            if (!node.state.compare_exchange_strong(expected, 1, std::memory_order_acq_rel)) break;
+            expand(index);
+            if (node.state.load(std::memory_order_acquire) != 2 || node.result.load(std::memory_order_relaxed) != 0) break;
+        } else if (st != 2) {
+            break; // 他のスレッドが展開中、または木が一杯
+        }
+        if (len >= 128) break;
+        index = select_child(node);
+        nodes[index].visits.fetch_add(1, std::memory_order_relaxed); // virtual loss を兼ねる
+        path[len++] = index;
+    }
+
+    // 末端の局面から勝敗を決める
+    const Node& leaf = nodes[path[len - 1]];
+    int leaf_color = (len - 1) & 1;
+    uint64_t played[2] = {0, 0};
+    int winner;
+    int r = leaf.result.load(std::memory_order_relaxed);
+    if (r != 0) winner = (r > 0) ? leaf_color : leaf_color ^ 1;
+    else winner = playout(leaf.my, leaf.op, leaf.my_cap, leaf.op_cap, leaf_color, rng, played);
+
+    // 逆伝播。path[i] へ来た手を打ったのは色 (i+1) % 2
+    for (int i = len - 1; i >= 0; --i) {
+        Node& node = nodes[path[i]];
+        int mover = (i + 1) & 1;
+        if (winner == mover) node.wins.fetch_add(1, std::memory_order_relaxed);
+
+        if (node.state.load(std::memory_order_acquire) == 2 && node.num_children > 0) {
+            // AMAF: この局面の手番側 (色 i % 2) が後で打ったマスの子を更新
+            int color = i & 1;
+            uint64_t later = played[color];
+            bool won = (winner == color);
+            for (uint32_t c = node.first_child; c < node.first_child + node.num_children; ++c) {
+                if ((later >> nodes[c].move) & 1) {
+                    nodes[c].amaf_visits.fetch_add(1, std::memory_order_relaxed);
+                    if (won) nodes[c].amaf_wins.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            if (i + 1 < len && nodes[path[i + 1]].result.load(std::memory_order_relaxed) != 0) update_proven(node);
+        }
+        if (node.move >= 0) played[mover] |= 1ULL << node.move;
+    }
+}
+
+MiniGoMCTS::MoveEval MiniGoMCTS::evaluate(uint64_t my, uint64_t op, int my_cap, int op_cap, uint64_t playouts) {
+    reset_tree(my & full_mask, op & full_mask, my_cap, op_cap);
+
+    std::atomic<uint64_t> done{0};
+    auto worker = [&](uint64_t seed) {
+        Rng rng{seed * 0x9E3779B97F4A7C15ULL + 1};
+        while (nodes[0].result.load(std::memory_order_relaxed) == 0 &&
+               done.fetch_add(1, std::memory_order_relaxed) < playouts) {
+            simulate(rng);
+        }
+    };
+    std::vector<std::thread> threads;
+    for (int t = 1; t < num_threads; ++t) threads.emplace_back(worker, (uint64_t)t + 1);
+    worker(1);
+    for (auto& th : threads) th.join();
+
+    // 根の手番側 (my) の勝率: 確定していればその値、そうでなければ最多訪問の子の勝率
+    MoveEval ev;
+    const Node& root = nodes[0];
+    int r = root.result.load(std::memory_order_relaxed);
+    if (r != 0) {
+        ev.win_rate = (r > 0) ? 1.0 : 0.0;
+        ev.separation = 1.0;
+        ev.visits = root.visits.load(std::memory_order_relaxed);
+        ev.proven = true;
+    } else {
+        uint32_t best = 0;
+        uint32_t best_visits = 0;
+        if (root.state.load(std::memory_order_acquire) == 2) {
+            for (uint32_t i = root.first_child; i < root.first_child + root.num_children; ++i) {
+                uint32_t v = nodes[i].visits.load(std::memory_order_relaxed);
+                if (best == 0 || v > best_visits) {
+                    best = i;
+                    best_visits = v;
+                }
+            }
+        }
+        const Node& b = nodes[best];
+        double n = std::max<uint32_t>(b.visits.load(std::memory_order_relaxed), 1);
+        double p = b.wins.load(std::memory_order_relaxed) / n;
+        if (best == 0) p = 1.0 - p; // 展開されなかった: 根の統計 (根へ来た側の勝率) を裏返す
+        ev.win_rate = p;
+        // 勝率 0.5 からの離れ具合を標準誤差で割り、正規分布で 0.5..1 に直す
+        // (z 値の言い換えで、信頼度ではない)
+        double se = std::sqrt(std::max(p * (1 - p), 1e-6) / n);
+        ev.separation = 0.5 * std::erfc(-std::fabs(p - 0.5) / se / std::sqrt(2.0));
+        ev.visits = (uint64_t)n;
+        ev.proven = false;
+    }
+    ev.mark = (ev.win_rate > 0.5) ? 'g' : 'r';
+    return ev;
+}
+
+std::vector<MiniGoMCTS::MoveEval> MiniGoMCTS::analyze(int n, int m, uint64_t playouts) {
+    set_board_size(n);
+    set_capture_target(m);
+
+    std::vector<MoveEval> result(n);
+    int half_n = (n + 1) / 2;
+    for (int i = 0; i < half_n; ++i) {
+        uint64_t move_bit = 1ULL << i;
+        uint64_t removed;
+        if (!apply_move(0, 0, full_mask, i, removed)) {
+            result[i] = {'x', 0.0, 1.0, 0, true};
+            continue;
+        }
+        // 初手の後は相手の手番。相手の勝率を裏返す
+        MoveEval ev = evaluate(0, move_bit, 0, 0, playouts);
+        ev.win_rate = 1.0 - ev.win_rate;
+        ev.mark = (ev.win_rate > 0.5) ? 'g' : 'r';
+        result[i] = ev;
+    }
+    for (int i = half_n; i < n; ++i) result[i] = result[n - 1 - i];
+    return result;
+}
+
+std::string MiniGoMCTS::to_map(const std::vector<MoveEval>& evals) {
+    std::string s;
+    for (const auto& e : evals) s += e.mark;
+    return s;
+}
+
+double MiniGoMCTS::measure_playouts(uint64_t count) {
+    Rng rng{0x123456789ABCDEFULL};
+    uint64_t played[2];
+    uint64_t sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < count; ++i) {
+        played[0] = played[1] = 0;
+        sink += playout(0, 0, 0, 0, 0, rng, played);
+    }
+    double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return (sec > 0 && sink != ~0ULL) ? count / sec : 0.0;
+}
@@ -0,0 +1,102 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <string>
+#include <atomic>
+#include <memory>
+
+// 完全解析が届かない大きな N (30..63) 向けのモンテカルロ木探索
+// 盤面は MiniGoMT と同じ 1xN ビットボード (ビット i = マス i)、ルールも同じ (先に m 個取った方が勝ち)
+//
+// - 選択: UCT + RAVE (AMAF)。β = ñ / (n + ñ + 4 b² n ñ) で AMAF から実際の勝率へ移る
+// - プレイアウト: 取れる手があれば取る (呼吸点1つの連をビット演算でまとめて求める)。
+//   なければ空点を一様に選び、自殺手なら候補から外して引き直す (合法手の一覧は作らない)
+// - 終局が分かっている局面 (m 個目を取れる / 打つ手がない) は勝敗を確定させて親へ伝える (MCTS-Solver)
+// - 並列化: 1本の木を複数スレッドで共有 (tree parallelism)。降りるときに先に visits を足すことで
+//   virtual loss とし、他のスレッドが同じ枝へ集まるのを防ぐ
+class MiniGoMCTS {
+public:
+    // 初手1つぶんの結果
+    struct MoveEval {
+        char mark;          // 'g'=勝ち, 'r'=負け, 'x'=自殺手
+        double win_rate;    // 初手を打った側の推定勝率
+        double separation;  // 勝率が 0.5 から標準誤差何個ぶん離れたかを正規分布で 0.5..1 に直した値 (確定なら 1)
+                            // 木の中の試行は独立ではないので、判定を誤る確率としては較正していない
+        uint64_t visits;    // 相手の最善応手 (最多訪問) の訪問数
+        bool proven;        // 木の中で勝敗が確定した
+    };
+
+    // max_nodes: 木のノード数の上限 (1ノード 48 バイト)。threads <= 0 ならハードウェアのスレッド数
+    MiniGoMCTS(size_t max_nodes = 1 << 21, int threads = 0);
+
+    void set_board_size(int n);
+    void set_capture_target(int m);
+    int get_board_size() const { return n_size; }
+
+    // 空の盤面からの各初手を playouts 回ずつ探索する (左右対称なので半分だけ)
+    std::vector<MoveEval> analyze(int n, int m, uint64_t playouts);
+
+    // 局面 (my の手番) を探索して、my の推定勝率を返す
+    MoveEval evaluate(uint64_t my, uint64_t op, int my_cap, int op_cap, uint64_t playouts);
+
+    // MoveEval の並びを "rgrxg..." にする
+    static std::string to_map(const std::vector<MoveEval>& evals);
+
+    // 1スレッドでランダムプレイアウトを count 回行い、1秒あたりの回数を返す (速度計測用)
+    double measure_playouts(uint64_t count);
+
+private:
+    struct Rng {
+        uint64_t s;
+        uint64_t next() {
+            // xorshift64*
+            s ^= s >> 12;
+            s ^= s << 25;
+            s ^= s >> 27;
+            return s * 0x2545F4914F6CDD1DULL;
+        }
+        // [0, n) の一様乱数
+        int below(int n) { return (int)(((next() >> 32) * (uint64_t)n) >> 32); }
+    };
+
+    struct Node {
+        uint64_t my, op;                 // この局面の手番側 / 相手
+        int16_t my_cap, op_cap;
+        int8_t move;                     // この局面へ来た手 (根は -1)
+        std::atomic<int8_t> result;      // 手番側から見た確定結果 1=勝ち, -1=負け, 0=未確定
+        std::atomic<uint8_t> state;      // 0=葉, 1=展開中, 2=展開済み
+        uint8_t num_children;
+        uint32_t first_child;
+        std::atomic<uint32_t> visits;
+        std::atomic<uint32_t> wins;      // この局面へ来る手を打った側の勝ち数
+        std::atomic<uint32_t> amaf_visits;
+        std::atomic<uint32_t> amaf_wins;
+    };
+
+    static const uint32_t EXPAND_VISITS = 4; // この回数訪れた葉を展開する
+
+    int n_size = 0;
+    uint64_t full_mask = 0;
+    int capture_target = 1;
+    int num_threads;
+
+    size_t capacity;
+    std::unique_ptr<Node[]> nodes;
+    std::atomic<size_t> used{0};
+
+    void reset_tree(uint64_t my, uint64_t op, int my_cap, int op_cap);
+    void init_node(Node& node, uint64_t my, uint64_t op, int my_cap, int op_cap, int move);
+    void expand(uint32_t index);
+    uint32_t select_child(const Node& parent) const;
+    void update_proven(Node& parent);
+
+    // 根から1回シミュレーションする
+    void simulate(Rng& rng);
+
+    // ランダムプレイアウト。color: 手番側の色。勝った色を返し、各色が打ったマスを played に足す
+    int playout(uint64_t my, uint64_t op, int my_cap, int op_cap, int color, Rng& rng, uint64_t played[2]) const;
+
+    // 空点 idx に打った結果: 取った石 (removed)。自殺手なら false
+    bool apply_move(uint64_t my, uint64_t op, uint64_t empty, int idx, uint64_t& removed) const;
+    int pick(uint64_t candidates, Rng& rng) const;
+};
@@ -1,4 +1,7 @@
 #include "MiniGoMT.h"
+#include "BitUtil.h"
+#include "SearchStats.h"
+#include "MoveRules.h"
 #include <algorithm>
 #include <random>
 #include <cstring>
@@ -8,6 +11,7 @@
 
 #if defined(_MSC_VER)
 #include <intrin.h>
+#include <xmmintrin.h>
 #pragma intrinsic(_BitScanForward64)
 #pragma intrinsic(_BitScanReverse64)
 #endif
@@ -33,6 +37,22 @@ inline int bit_scan_reverse(uint64_t b) {
 #endif
 }
 
+thread_local MiniGoMT::WorkerCounters* MiniGoMT::current_counters = nullptr;
+
+// 書くスレッドが1つだけのカウンタを1増やす (読む側は relaxed で概数が取れればよい)
+static inline void bump(std::atomic<uint64_t>& counter) {
+    counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+// 置換表の行を先読みする (書き込み前提なので書き込み用のヒント)
+static inline void prefetch(const void* p) {
+#if defined(_MSC_VER)
+    _mm_prefetch((const char*)p, _MM_HINT_T0);
+#else
+    __builtin_prefetch(p, 1, 3);
+#endif
+}
+
 MiniGoMT::MiniGoMT(int tt_bits) {
     size_t size = 1ULL << tt_bits;
     tt.resize(size);
@@ -48,23 +68,75 @@ void MiniGoMT::init_zobrist() {
         zobrist_my[i] = rng();
         zobrist_op[i] = rng();
     }
+    for (int i = 0; i < 64; ++i) {
+        zobrist_cap_my[i] = (i == 0) ? 0 : rng();
+        zobrist_cap_op[i] = (i == 0) ? 0 : rng();
+    }
+    for (int i = 0; i < 64; ++i) {
+        zobrist_pos[0][i] = rng();
+        zobrist_pos[1][i] = rng();
+    }
+    zobrist_side = rng();
 }
 
 void MiniGoMT::clear_tt() {
     std::memset(tt.data(), 0, tt.size() * sizeof(TTEntry));
+    if (!tt_hist.empty()) std::memset(tt_hist.data(), 0, tt_hist.size() * sizeof(TTEntry));
+    // 2段目を作り直せなかったら、以後は RAM の表だけで探索する
+    if (disk_tt.is_open() && !disk_tt.clear()) disk_depth = -1;
 }
 
+bool MiniGoMT::enable_disk_tt(const std::string& path, int bits, int max_depth) {
+    // 2段目のキーは盤の大きさや m を含まないので、RAM の表と同じく空から始める
+    if (!disk_tt.open(path, bits)) {
+        disk_depth = -1;
+        return false;
+    }
+    disk_depth = std::max(0, std::min(max_depth, 255));
+    return true;
+}
+
+void MiniGoMT::disable_disk_tt() {
+    disk_tt.close();
+    disk_depth = -1;
+}
+
+// 超コウ判定用の盤面ハッシュ (手番側 my の色が side)
+uint64_t MiniGoMT::board_hash(uint64_t my, uint64_t op, int side) const {
+    uint64_t h = 0;
+    for (uint64_t b = my; b; b &= b - 1) h ^= zobrist_pos[side][bit_scan_forward(b)];
+    for (uint64_t b = op; b; b &= b - 1) h ^= zobrist_pos[side ^ 1][bit_scan_forward(b)];
+    return h;
+}
+
+static inline uint64_t mix64(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+int MiniGoMT::PathHistory::find(uint64_t h, int end) const {
+    if (filter[h >> 52] == 0) return -1;
+    for (int i = 0; i < end; ++i) {
+        if (nodes[i].hash == h) return i;
+    }
+    return -1;
+}
+
+// 石のあるマスだけ回す (値は全マスを見るのと同じ)
 uint64_t MiniGoMT::compute_hash(uint64_t my, uint64_t op) const {
-    uint64_t h1 = 0;
-    for (int i = 0; i < n_size; ++i) {
-        if ((my >> i) & 1) h1 ^= zobrist_my[i];
-        if ((op >> i) & 1) h1 ^= zobrist_op[i];
+    const int n = n_size;
+    uint64_t h1 = 0, h2 = 0;
+    for (uint64_t b = my; b; b &= b - 1) {
+        int i = bit_scan_forward(b);
+        h1 ^= zobrist_my[i];
+        h2 ^= zobrist_my[n - 1 - i];
     }
-    uint64_t h2 = 0;
-    for (int i = 0; i < n_size; ++i) {
-        int rev_i = n_size - 1 - i;
-        if ((my >> i) & 1) h2 ^= zobrist_my[rev_i];
-        if ((op >> i) & 1) h2 ^= zobrist_op[rev_i];
+    for (uint64_t b = op; b; b &= b - 1) {
+        int i = bit_scan_forward(b);
+        h1 ^= zobrist_op[i];
+        h2 ^= zobrist_op[n - 1 - i];
     }
     return std::min(h1, h2);
 }
@@ -97,11 +169,42 @@ bool MiniGoMT::is_captured(uint64_t stones, uint64_t empty, uint64_t start_bit)
     return !(lib_left || lib_right);
 }
 
-int MiniGoMT::solve(uint64_t my, uint64_t op, int alpha, int beta, int depth) {
-    uint64_t key = compute_hash(my, op);
+MiniGoMT::Keys MiniGoMT::compute_keys(uint64_t my, uint64_t op) const {
+    const int n = n_size;
+    Keys k = {0, 0, 0, 0};
+    for (uint64_t b = my; b; b &= b - 1) {
+        int i = bit_scan_forward(b);
+        k.a ^= zobrist_my[i];
+        k.b ^= zobrist_op[i];
+        k.ra ^= zobrist_my[n - 1 - i];
+        k.rb ^= zobrist_op[n - 1 - i];
+    }
+    for (uint64_t b = op; b; b &= b - 1) {
+        int i = bit_scan_forward(b);
+        k.a ^= zobrist_op[i];
+        k.b ^= zobrist_my[i];
+        k.ra ^= zobrist_op[n - 1 - i];
+        k.rb ^= zobrist_my[n - 1 - i];
+    }
+    return k;
+}
+
+int MiniGoMT::solve(uint64_t my, uint64_t op, int my_cap, int op_cap, int alpha, int beta, int depth) {
+    return search(my, op, my_cap, op_cap, compute_keys(my, op), alpha, beta, depth);
+}
+
+int MiniGoMT::search(uint64_t my, uint64_t op, int my_cap, int op_cap, const Keys& keys,
+                     int alpha, int beta, int depth) {
+    const int n = n_size;
+
+    MINIGO_STAT(SearchStats::local().node(depth));
+    WorkerCounters* counters = current_counters;
+    if (counters) bump(counters->nodes);
+    uint64_t key = std::min(keys.a, keys.ra) ^ zobrist_cap_my[my_cap] ^ zobrist_cap_op[op_cap];
     size_t idx = key & tt_mask;
 
     TTEntry entry = tt[idx]; 
+    MINIGO_STAT(SearchStats::local().probe(entry, key));
     if (entry.flag && entry.key == key) {
         return entry.score;
     }
@@ -117,101 +220,384 @@ int MiniGoMT::solve(uint64_t my, uint64_t op, int alpha, int beta, int depth) {
     // 3. その他 (飛び石)
     uint64_t rest = empty & ~(op_adj | my_adj);
 
-    bool can_move = false;
-    int max_val = -2;
+    // 追い出すエントリが浅い (大きな部分木の) 局面なら2段目へ移す
+    auto store = [&](int score) {
+        MINIGO_STAT(SearchStats::local().store(tt[idx], key));
+        if (counters && !entry.flag) bump(counters->tt_filled);
+        // 子の探索中に同じ行が書き換わっていることがあるので、ここで読み直す
+        const TTEntry old = tt[idx];
+        if (old.flag && old.key != key && old.depth <= disk_depth) disk_tt.store(old);
+        tt[idx] = {key, (int16_t)score, 1, (uint8_t)std::min(depth, 255)};
+    };
+
+    // RAM に無ければ、浅い局面だけ2段目を引く (当たったら RAM に戻す)
+    if (depth <= disk_depth) {
+        int16_t disk_score;
+        if (disk_tt.probe(key, disk_score)) {
+            store(disk_score);
+            return disk_score;
+        }
+    }
+
+    // 1. 合法手の子局面を優先順にすべて作る。m 個目を取れる手があればその場で勝ち
+    //    子のキーは親の Keys からの差分 (打った石と取った石だけ XOR) で求め、置換表の行をプリフェッチしておく
+    struct Child {
+        uint64_t my, op; // 子局面の手番側 (= 今の相手) / 相手
+        Keys keys;
+        uint64_t key;    // 子局面の置換表キー
+        uint64_t move_bit;
+        int cap;         // 子局面の相手 (= 今の手番側) が取った数
+    };
+    Child children[64];
+    int count = 0;
+
+    // 左右対称な局面なら右半分の手は調べない (MIRROR)
+    const uint64_t keep = (rules & moverules::MIRROR) ? moverules::mirror_filter(my, op, n) : ~0ULL;
+    const bool self_atari = (rules & moverules::SELF_ATARI) != 0;
 
-    // ラムダ式で探索ロジックを共通化 (インライン展開される)
-    auto process_moves = [&](uint64_t moves_mask) -> int {
-        while (moves_mask) {
+    const uint64_t order[3] = { op_adj & keep, my_adj & keep, rest & keep };
+    for (int k = 0; k < 3; ++k) {
+        for (uint64_t moves_mask = order[k]; moves_mask; moves_mask &= moves_mask - 1) {
             int move_idx = bit_scan_forward(moves_mask);
             uint64_t move_bit = 1ULL << move_idx;
-            moves_mask &= ~move_bit;
-
             uint64_t next_my = my | move_bit;
-            bool captured = false;
+            uint64_t removed = 0;
 
             // 捕獲チェック (move_idxの隣だけ見れば良い)
             if ((move_idx > 0) && ((op >> (move_idx - 1)) & 1)) {
-                if (is_captured(op, empty & ~move_bit, 1ULL << (move_idx - 1))) captured = true;
+                if (is_captured(op, empty & ~move_bit, 1ULL << (move_idx - 1))) {
+                    removed |= bitutil::group_mask(op, move_idx - 1);
+                }
             }
-            if (!captured && (move_idx < n_size - 1) && ((op >> (move_idx + 1)) & 1)) {
-                if (is_captured(op, empty & ~move_bit, 1ULL << (move_idx + 1))) captured = true;
+            if ((move_idx < n - 1) && ((op >> (move_idx + 1)) & 1)) {
+                if (is_captured(op, empty & ~move_bit, 1ULL << (move_idx + 1))) {
+                    removed |= bitutil::group_mask(op, move_idx + 1);
+                }
             }
 
-            if (captured) {
-                return 1; // 勝ち確定シグナル
+            // m > 1: 取った連を盤から除き、取った数を数える
+            int next_cap = my_cap;
+            if (removed) {
+                next_cap += bitutil::popcount(removed);
+                if (next_cap >= capture_target) {
+                    MINIGO_STAT(SearchStats::local().capture_win());
+                    store(1);
+                    return 1;
+                }
+            } else if (is_captured(next_my, empty & ~move_bit, move_bit)) {
+                // 自殺手チェック (取れた場合は呼吸点ができるので対象外)
+                continue;
             }
 
-            // 自殺手チェック
-            if (is_captured(next_my, empty & ~move_bit, move_bit)) {
+            // 相手が次の手で勝てる形を残す手は負けなので子に入れない (SELF_ATARI)
+            // 全部そうなら count == 0 になり、打てる手がないときと同じく負け
+            if (self_atari &&
+                moverules::loses_to_capture(next_my, (empty & ~move_bit) | removed, op_cap, capture_target)) {
                 continue;
             }
 
-            can_move = true;
-            int score = -solve(op, next_my, -beta, -alpha, depth + 1);
+            // 子局面では手番が替わるので a と b が入れ替わる
+            const int rev_idx = n - 1 - move_idx;
+            Child& c = children[count++];
+            c.my = op & ~removed;
+            c.op = next_my;
+            c.keys = { keys.b ^ zobrist_op[move_idx], keys.a ^ zobrist_my[move_idx],
+                       keys.rb ^ zobrist_op[rev_idx], keys.ra ^ zobrist_my[rev_idx] };
+            for (uint64_t r = removed; r; r &= r - 1) {
+                int i = bit_scan_forward(r);
+                c.keys.a ^= zobrist_my[i];
+                c.keys.b ^= zobrist_op[i];
+                c.keys.ra ^= zobrist_my[n - 1 - i];
+                c.keys.rb ^= zobrist_op[n - 1 - i];
+            }
+            c.key = std::min(c.keys.a, c.keys.ra) ^ zobrist_cap_my[op_cap] ^ zobrist_cap_op[next_cap];
+            c.move_bit = move_bit;
+            c.cap = next_cap;
+            prefetch(&tt[c.key & tt_mask]);
+        }
+    }
+
+    if (count == 0) {
+        store(-1);
+        return -1;
+    }
 
-            if (score > max_val) {
-                max_val = score;
-                if (score >= beta) return 2; // Beta Cutoffシグナル
-                if (score > alpha) alpha = score;
+    // 2. ETC: 置換表で負けと分かっている子があれば、再帰せずに勝ち
+    //    (プリフェッチを出し終わってから読むので、各行の読み込みは重なる)
+    for (int i = 0; i < count; ++i) {
+        const TTEntry& e = tt[children[i].key & tt_mask];
+        if (e.flag && e.key == children[i].key && e.score < 0) {
+            MINIGO_STAT(SearchStats::local().etc_cutoff());
+            store(1);
+            return 1;
+        }
+    }
+
+    // 3. 優先順に再帰
+    int max_val = -2;
+    for (int i = 0; i < count; ++i) {
+        const Child& c = children[i];
+        int score = -search(c.my, c.op, op_cap, c.cap, c.keys, -beta, -alpha, depth + 1);
+
+        if (score > max_val) {
+            max_val = score;
+            if (score >= beta) {
+                MINIGO_STAT(SearchStats::local().cutoff_ordered(op_adj, my_adj, rest, c.move_bit));
+                break; // Beta Cutoff
             }
+            if (score > alpha) alpha = score;
         }
-        return 0; // 続行
-    };
+    }
 
-    // 優先順位に従って実行
-    if (int res = process_moves(op_adj)) {
-        if (res == 1) { tt[idx] = {key, 1, 1}; return 1; }
-        if (res == 2) { tt[idx] = {key, (int16_t)max_val, 1}; return max_val; }
+    store(max_val);
+    return max_val;
+}
+
+
+// 祖先の盤面 A が cur から再び現れるには、
+//  - cur にあって A にない石は全て取られる必要がある (相手の取り数がその分増える)
+//  - A から A に戻るまでに両者とも置いた数 = 取られた数 で、手番は交互なので
+//    A 以降に増える取り数の差は 1 以下、かつ両者とも 1 以上
+//  - m 個目の取りは即勝ちなので、再現する局面での取り数はどちらも m-1 以下
+// のどれかが満たせなければ、その祖先はこの先の探索に影響しない
+bool MiniGoMT::may_recur(const PathEntry& a, const PathEntry& cur) const {
+    int lo[2], hi[2];
+    for (int c = 0; c < 2; ++c) {
+        int must_lose = bitutil::popcount(cur.stones[c ^ 1] & ~a.stones[c ^ 1]);
+        // 色 c が A 以降に増やす取り数の範囲
+        lo[c] = std::max(cur.cap[c] + must_lose, a.cap[c] + 1) - a.cap[c];
+        hi[c] = (capture_target - 1) - a.cap[c];
+        if (lo[c] > hi[c]) return false;
     }
-    if (int res = process_moves(my_adj)) {
-        if (res == 1) { tt[idx] = {key, 1, 1}; return 1; }
-        if (res == 2) { tt[idx] = {key, (int16_t)max_val, 1}; return max_val; }
+    return lo[0] <= hi[1] + 1 && lo[1] <= hi[0] + 1;
+}
+
+// 超コウあり (勝ち負けのみ、窓は常に [-1, 1])
+// 取りのない手は石が1つ増えるだけなので、最後に取りが起きた局面 (last_cap) 以降の
+// 祖先とは一致しない。取りのある手だけ経路全体と照合すればよい
+//
+// GHI 対策: 結果は「この先また現れうる祖先」の集合にだけ依存する。
+// その集合が空なら履歴と無関係なので共有TTへ、空でなければ集合をキーに含めて tt_hist へ入れる
+int MiniGoMT::solve_superko(uint64_t my, uint64_t op, int my_cap, int op_cap, int side, int last_cap,
+                            PathHistory& path) {
+    int depth = (int)path.nodes.size() - 1;
+    MINIGO_STAT(SearchStats::local().node(depth));
+    if (WorkerCounters* counters = current_counters) bump(counters->nodes);
+    const PathEntry cur = path.nodes[depth]; // push で再確保されるのでコピーしておく
+
+    // 盤面ハッシュは線形なので、攪拌してから集合のハッシュにする
+    uint64_t relevant = 0;
+    bool has_relevant = false;
+    for (int i = 0; i < depth; ++i) {
+        if (may_recur(path.nodes[i], cur)) {
+            relevant ^= mix64(path.nodes[i].hash);
+            has_relevant = true;
+        }
     }
-    if (int res = process_moves(rest)) {
-        if (res == 1) { tt[idx] = {key, 1, 1}; return 1; }
-        if (res == 2) { tt[idx] = {key, (int16_t)max_val, 1}; return max_val; }
+
+    uint64_t key;
+    size_t idx;
+    TTEntry* table;
+    if (!has_relevant) {
+        key = compute_hash(my, op) ^ zobrist_cap_my[my_cap] ^ zobrist_cap_op[op_cap];
+        idx = key & tt_mask;
+        table = tt.data();
+    } else {
+        key = cur.hash ^ (side ? zobrist_side : 0) ^ zobrist_cap_my[my_cap] ^ zobrist_cap_op[op_cap];
+        key = mix64(key ^ mix64(relevant));
+        idx = key & tt_hist_mask;
+        table = tt_hist.data();
+    }
+    TTEntry entry = table[idx];
+    MINIGO_STAT(SearchStats::local().probe(entry, key));
+    if (entry.flag && entry.key == key) {
+        return entry.score;
     }
 
-    if (!can_move) {
-        tt[idx] = {key, -1, 1};
-        return -1;
+    uint64_t empty = ~(my | op) & full_mask;
+    if (empty == 0) return -1;
+
+    uint64_t op_adj = ((op << 1) | (op >> 1)) & empty;
+    uint64_t my_adj = ((my << 1) | (my >> 1)) & empty & ~op_adj;
+    uint64_t rest = empty & ~(op_adj | my_adj);
+    uint64_t order[3] = { op_adj, my_adj, rest };
+
+    int result = -1;
+    for (int k = 0; k < 3 && result < 0; ++k) {
+        for (uint64_t moves_mask = order[k]; moves_mask; moves_mask &= moves_mask - 1) {
+            int move_idx = bit_scan_forward(moves_mask);
+            uint64_t move_bit = 1ULL << move_idx;
+            uint64_t next_empty = empty & ~move_bit;
+            uint64_t next_my = my | move_bit;
+
+            uint64_t removed = 0;
+            if ((move_idx > 0) && ((op >> (move_idx - 1)) & 1)) {
+                if (is_captured(op, next_empty, 1ULL << (move_idx - 1))) removed |= bitutil::group_mask(op, move_idx - 1);
+            }
+            if ((move_idx < n_size - 1) && ((op >> (move_idx + 1)) & 1)) {
+                if (is_captured(op, next_empty, 1ULL << (move_idx + 1))) removed |= bitutil::group_mask(op, move_idx + 1);
+            }
+            if (!removed && is_captured(next_my, next_empty, move_bit)) continue; // 自殺手
+
+            int next_cap = my_cap + bitutil::popcount(removed);
+            if (next_cap >= capture_target) {
+                MINIGO_STAT(SearchStats::local().capture_win());
+                result = 1;
+                break;
+            }
+
+            PathEntry child = cur;
+            child.hash ^= zobrist_pos[side][move_idx];
+            for (uint64_t r = removed; r; r &= r - 1) child.hash ^= zobrist_pos[side ^ 1][bit_scan_forward(r)];
+            child.stones[side] = next_my;
+            child.stones[side ^ 1] = op & ~removed;
+            child.cap[side] = next_cap;
+
+            // 超コウ: 過去の盤面を再現する手は打てない (直前の盤面とは必ず異なる)
+            if (path.find(child.hash, removed ? depth : last_cap) >= 0) continue;
+
+            path.push(child);
+            int score = -solve_superko(op & ~removed, next_my, op_cap, next_cap, side ^ 1,
+                                       removed ? depth + 1 : last_cap, path);
+            path.pop();
+
+            if (score == 1) {
+                MINIGO_STAT(SearchStats::local().cutoff_ordered(order[0], order[1], order[2], move_bit));
+                result = 1;
+                break;
+            }
+        }
     }
 
-    tt[idx] = {key, (int16_t)max_val, 1};
-    return max_val;
+    MINIGO_STAT(SearchStats::local().store(table[idx], key));
+    table[idx] = {key, (int16_t)result, 1, (uint8_t)std::min(depth, 255)};
+    return result;
 }
 
-std::string MiniGoMT::analyze_parallel(int n) {
+void MiniGoMT::set_board_size(int n) {
+    if (n == n_size) return;
+    n_size = n;
+    full_mask = (n >= 64) ? ~0ULL : ((1ULL << n) - 1);
+    clear_tt();
+}
+
+void MiniGoMT::set_superko(bool enable) {
+    if (enable == superko) return;
+    superko = enable;
+    // 履歴テーブルは使うときだけ確保する (本体TTの 1/16)
+    if (superko && tt_hist.empty()) {
+        tt_hist.resize(std::max<size_t>(tt.size() / 16, 1));
+        tt_hist_mask = tt_hist.size() - 1;
+    }
+    clear_tt();
+}
+
+void MiniGoMT::set_rules(unsigned r) {
+    if (r == rules) return;
+    rules = r;
+    clear_tt();
+}
+
+void MiniGoMT::set_capture_target(int m) {
+    m = std::max(1, std::min(m, 63));
+    if (m == capture_target) return;
+    capture_target = m;
+    clear_tt();
+}
+
+int MiniGoMT::solve_position(uint64_t my, uint64_t op, int my_cap, int op_cap) {
+    my &= full_mask;
+    op &= full_mask;
+    if (superko && capture_target > 1) {
+        PathHistory path;
+        path.push({board_hash(my, op, 0), {my, op}, {my_cap, op_cap}});
+        return solve_superko(my, op, my_cap, op_cap, 0, 0, path);
+    }
+    return solve(my, op, my_cap, op_cap, -1, 1, 0);
+}
+
+char MiniGoMT::evaluate_move(uint64_t my, uint64_t op, int move_idx, int my_cap, int op_cap) {
+    uint64_t move_bit = 1ULL << move_idx;
+    uint64_t empty = ~(my | op) & full_mask & ~move_bit;
+    uint64_t next_my = my | move_bit;
+
+    // 隣の相手グループを取る
+    uint64_t removed = 0;
+    if ((move_idx > 0) && ((op >> (move_idx - 1)) & 1)) {
+        if (is_captured(op, empty, 1ULL << (move_idx - 1))) removed |= bitutil::group_mask(op, move_idx - 1);
+    }
+    if ((move_idx < n_size - 1) && ((op >> (move_idx + 1)) & 1)) {
+        if (is_captured(op, empty, 1ULL << (move_idx + 1))) removed |= bitutil::group_mask(op, move_idx + 1);
+    }
+
+    int next_cap = my_cap + bitutil::popcount(removed);
+    if (next_cap >= capture_target) return 'g';
+    if (!removed && is_captured(next_my, empty, move_bit)) return 'x';
+
+    if (superko && capture_target > 1) {
+        // 1手目は直前の盤面とは必ず異なるので、根から履歴を積むだけでよい
+        PathHistory path;
+        path.push({board_hash(my, op, 0), {my, op}, {my_cap, op_cap}});
+        path.push({board_hash(next_my, op & ~removed, 0), {next_my, op & ~removed}, {next_cap, op_cap}});
+        int score = -solve_superko(op & ~removed, next_my, op_cap, next_cap, 1, removed ? 1 : 0, path);
+        return (score == 1) ? 'g' : 'r';
+    }
+
+    int score = -solve(op & ~removed, next_my, op_cap, next_cap, -1, 1, 1);
+    return (score == 1) ? 'g' : 'r';
+}
+
+std::string MiniGoMT::analyze_parallel(int n, int m) {
     n_size = n;
     full_mask = (1ULL << n) - 1;
+    capture_target = std::max(1, std::min(m, 63));
     clear_tt();
 
     std::string result(n, ' ');
     int half_n = (n + 1) / 2;
 
-    auto task_func = [&](int i) -> char {
-        uint64_t move_bit = 1ULL << i;
-        uint64_t my = move_bit;
-        uint64_t op = 0;
-        uint64_t empty = full_mask & ~move_bit;
-
-        if (is_captured(my, empty, move_bit)) return 'x';
+    for (auto& w : workers) {
+        w.nodes.store(0, std::memory_order_relaxed);
+        w.tt_filled.store(0, std::memory_order_relaxed);
+    }
+    moves_done.store(0, std::memory_order_relaxed);
+    moves_total.store(half_n, std::memory_order_relaxed);
 
-        int score = -solve(op, my, -1, 1, 1);
-        return (score == 1) ? 'g' : 'r';
+    auto task_func = [&](int i) -> char {
+        current_counters = &workers[i % MAX_WORKERS];
+        char c = evaluate_move(0, 0, i);
+        current_counters = nullptr;
+        moves_done.fetch_add(1, std::memory_order_relaxed);
+        return c;
     };
 
-    std::vector<std::future<char>> futures;
+    // 経験則で決まる初手は探索しない
+    std::vector<std::future<char>> futures(half_n);
     for (int i = 0; i < half_n; ++i) {
-        futures.push_back(std::async(std::launch::async, task_func, i));
+        char mark = moverules::root_mark(rules, n, capture_target, i);
+        if (mark) {
+            result[i] = mark;
+            moves_done.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            futures[i] = std::async(std::launch::async, task_func, i);
+        }
     }
 
     for (int i = 0; i < half_n; ++i) {
-        result[i] = futures[i].get();
+        if (futures[i].valid()) result[i] = futures[i].get();
     }
     for (int i = half_n; i < n; ++i) {
         result[i] = result[n - 1 - i];
     }
     return result;
-}
\ No newline at end of file
+}
+
+MiniGoMT::Progress MiniGoMT::get_progress() const {
+    Progress p = {0, 0, tt.size(), moves_done.load(std::memory_order_relaxed),
+                  moves_total.load(std::memory_order_relaxed)};
+    for (const auto& w : workers) {
+        p.nodes += w.nodes.load(std::memory_order_relaxed);
+        p.tt_filled += w.tt_filled.load(std::memory_order_relaxed);
+    }
+    return p;
+}
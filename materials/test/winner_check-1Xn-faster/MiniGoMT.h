@@ -3,36 +3,155 @@
 #include <vector>
 #include <string>
 #include <atomic>
-
-struct TTEntry {
-    uint64_t key;
-    int16_t score;
-    uint8_t flag; 
-};
+#include "TTEntry.h"
+#include "MoveRules.h"
+#include "DiskTT.h"
 
 class MiniGoMT {
 public:
     MiniGoMT(int tt_bits = 24);
     ~MiniGoMT();
 
-    std::string analyze_parallel(int n);
+    // m: 先に m 個取った方が勝ち (README の「m個とったら勝ち」)
+    std::string analyze_parallel(int n, int m = 1);
+
+    // 勝利条件 m を変える (変わったときだけTTをクリア)。m は 1..63
+    void set_capture_target(int m);
+    int get_capture_target() const { return capture_target; }
+
+    // 超コウ (同一局面の再現) を禁止するかどうか。切り替えたときはTTをクリア
+    // m個目を取る手はその場で勝ちとし、超コウは対局が続く局面にだけ適用する
+    // m=1 では局面が繰り返さないので、履歴付きの探索になるのは m>1 のときだけ
+    void set_superko(bool enable);
+    bool get_superko() const { return superko; }
+
+    // 探索に使う規則 (MoveRules.h の moverules::Rule の組み合わせ)。既定は証明済みの規則だけ
+    // 経験則 (EDGE_SECOND など) を入れると analyze_parallel の初手の一部を探索せずに決める
+    // 切り替えたときはTTをクリア (規則あり/なしの結果を独立に比べられるように)
+    void set_rules(unsigned rules);
+    unsigned get_rules() const { return rules; }
+
+    // 置換表の2段目 (DiskTT) をファイル path (2^bits エントリ) に作る。失敗したら false
+    // 深さ max_depth 以下の局面だけを、RAM の表から追い出されたときに2段目へ移し、RAM に無いときに2段目を引く
+    // (浅い局面ほど部分木が大きいので、ディスクを引く回数を抑えつつ大きな結果だけを残せる)
+    // max_depth を深くするほど RAM の表が小さいときに効くが、ディスクの読み書きが増える (N=22 で 8 前後が目安)
+    bool enable_disk_tt(const std::string& path, int bits, int max_depth = 8);
+    void disable_disk_tt();
+    const DiskTT& get_disk_tt() const { return disk_tt; }
+
+    // --- 任意局面の問い合わせ (HintServer などから利用) ---
+    // 盤面サイズを設定する。Nが変わったときだけTTをクリアし、同じNの問い合わせではTTを使い回す
+    void set_board_size(int n);
+    int get_board_size() const { return n_size; }
+
+    // 手番側(my)から見た勝敗 1=勝ち, -1=負け
+    // my_cap/op_cap: それぞれがこれまでに取った石の数
+    int solve_position(uint64_t my, uint64_t op, int my_cap = 0, int op_cap = 0);
+
+    // 空点 move_idx に打った結果を返す 'g'=勝ち, 'r'=負け, 'x'=自殺手
+    char evaluate_move(uint64_t my, uint64_t op, int move_idx, int my_cap = 0, int op_cap = 0);
+
+    // --- 進み具合 (ProgressReporter から別スレッドで読む) ---
+    struct Progress {
+        uint64_t nodes;     // analyze_parallel を始めてから訪れた局面数
+        uint64_t tt_filled; // 空きエントリに書き込んだ数 (概算、置換表の埋まり具合)
+        uint64_t tt_size;
+        int moves_done;     // 解き終わった初手の数
+        int moves_total;
+    };
+    Progress get_progress() const;
 
 private:
-    int n_size;
+    friend class KernelBench; // 計測用 (KernelBench.h)
+
+    // 初手ごとのスレッドのカウンタ。書くのは担当スレッドだけなので relaxed の load/store で足りる
+    // (fetch_add のロックを避ける)。キャッシュラインを分けて偽共有を防ぐ
+    struct alignas(64) WorkerCounters {
+        std::atomic<uint64_t> nodes{0};
+        std::atomic<uint64_t> tt_filled{0};
+    };
+    static const int MAX_WORKERS = 32; // 初手は左右対称の半分だけ解くので N <= 63 で足りる
+    WorkerCounters workers[MAX_WORKERS];
+    std::atomic<int> moves_done{0};
+    std::atomic<int> moves_total{0};
+    // 今のスレッドが数えるカウンタ (analyze_parallel のタスク以外から呼ばれたときは nullptr)
+    static thread_local WorkerCounters* current_counters;
+
+    int n_size = 0;
     uint64_t full_mask;
+    int capture_target = 1;
+    bool superko = false;
+    unsigned rules = moverules::PROVEN;
 
     // Transposition Table
     std::vector<TTEntry> tt;
     uint64_t tt_mask;
 
+    // 2段目の置換表と、それを使う深さの上限 (使わないときは -1)
+    DiskTT disk_tt;
+    int disk_depth = -1;
+
     uint64_t zobrist_my[64];
     uint64_t zobrist_op[64];
+    // 取った石の数 (0 のときは 0 なので m=1 のキーは従来と同じ)
+    uint64_t zobrist_cap_my[64];
+    uint64_t zobrist_cap_op[64];
+
+    // 超コウ用: 盤面そのもの(黒白の区別あり、左右反転なし)のハッシュ
+    uint64_t zobrist_pos[2][64];
+    uint64_t zobrist_side;
+
+    // 履歴に依存した結果だけを入れる別テーブル (キーに関係する祖先局面の集合を含める)
+    std::vector<TTEntry> tt_hist;
+    uint64_t tt_hist_mask = 0;
+
+    // 探索経路上の局面 (色は絶対: stones[0] が根の手番側)
+    struct PathEntry {
+        uint64_t hash;
+        uint64_t stones[2];
+        int cap[2]; // それぞれの色が取った石の数
+    };
+
+    // 探索経路のスタック (スレッドごとに1つ)
+    struct PathHistory {
+        std::vector<PathEntry> nodes; // nodes[d] = 深さ d の局面
+        uint16_t filter[4096] = {};   // 上位12ビットごとの出現数 (再現チェックの早期棄却)
+
+        void push(const PathEntry& e) { nodes.push_back(e); ++filter[e.hash >> 52]; }
+        void pop() { --filter[nodes.back().hash >> 52]; nodes.pop_back(); }
+        // nodes[0..end) に盤面 h があればその深さ、なければ -1
+        int find(uint64_t h, int end) const;
+    };
 
     void init_zobrist();
     void clear_tt();
 
-    int solve(uint64_t my, uint64_t op, int alpha, int beta, int depth);
+    int solve(uint64_t my, uint64_t op, int my_cap, int op_cap, int alpha, int beta, int depth);
+
+    // 盤面の Zobrist 和を4通り持っておき、子局面のキーは XOR の差分で作る
+    //   a = Σ my[i] ^ op[i], b = 色を入れ替えた和 (子局面では手番が替わるので a と b が入れ替わる)
+    //   ra, rb = 左右反転した位置 (N-1-i) で引いた和。置換表のキーは min(a, ra)
+    struct Keys {
+        uint64_t a, b, ra, rb;
+    };
+    Keys compute_keys(uint64_t my, uint64_t op) const;
+
+    // solve の本体。子局面のキーを先にまとめて作って置換表をプリフェッチし、
+    // 負けと分かっている子があれば再帰せずに勝ちを返す (Enhanced Transposition Cutoff)
+    int search(uint64_t my, uint64_t op, int my_cap, int op_cap, const Keys& keys,
+               int alpha, int beta, int depth);
+
+    // 超コウありの探索 (勝ち負けのみ)。path.nodes.back() が現局面
+    // side: 手番側の色 (0/1), last_cap: 最後に取りが起きた手で生じた局面の深さ
+    int solve_superko(uint64_t my, uint64_t op, int my_cap, int op_cap, int side, int last_cap,
+                      PathHistory& path);
+
+    // 祖先 a の盤面に cur からもう一度到達できる可能性があるか (必要条件による判定)
+    bool may_recur(const PathEntry& a, const PathEntry& cur) const;
+
+    uint64_t board_hash(uint64_t my, uint64_t op, int side) const;
 
+    // 石のあるマスだけを回す (空きマスの多い序盤ほど速い)
     uint64_t compute_hash(uint64_t my, uint64_t op) const;
     
     // O(1) に高速化された判定関数
@@ -0,0 +1,17 @@
+#include "MoveRules.h"
+
+namespace moverules {
+
+const RuleInfo RULES[] = {
+    {SELF_ATARI, "self_atari", true, 0,
+     "a move leaving own group with one liberty loses when the opponent needs one more capture"},
+    {MIRROR, "mirror", true, 0,
+     "in a left-right symmetric position only moves on the left half (with the center) are searched"},
+    // m=1 の完全解析 (N=1..25) で確認。N=4 は 'rggr' なので N>=5 から
+    {EDGE_SECOND, "edge_second", false, 25,
+     "m=1, N>=5: first moves on cells 1 and N-2 lose"},
+};
+
+const int RULE_COUNT = sizeof(RULES) / sizeof(RULES[0]);
+
+} // namespace moverules
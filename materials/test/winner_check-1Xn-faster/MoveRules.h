@@ -0,0 +1,55 @@
+#pragma once
+#include <cstdint>
+#include "BitUtil.h"
+
+// 探索の手を減らすための規則 (1xN、ビット i = マス i)
+// - 証明済みの規則: 探索の中で使っても結果は変わらない (main_rules で規則あり/なしを突き合わせて確認)
+// - 経験則: 完全解析の結果を verified_up_to まで調べて成り立っていただけのもの。根の初手にだけ使い、既定では切っておく
+// 規則はビットフラグで、MiniGoMT::set_rules で個別に切り替える
+namespace moverules {
+
+enum Rule : unsigned {
+    // 証明済み: 打った後の盤に呼吸点1つの自分の連があり、相手があと1個で勝つなら、その手は負け
+    // (相手は次の手でそれを取って勝つ)。アタリを受けている局面では、それを解消する手だけが残る。
+    // 初手の端 (マス 0, N-1) もこれで落ちる
+    SELF_ATARI = 1u << 0,
+    // 証明済み: 左右対称な局面では反転した手も同じ結果になるので、左半分 (中央を含む) だけ調べる
+    MIRROR = 1u << 1,
+    // 経験則 (m=1, N>=5): 初手のマス 1 と N-2 は負け
+    EDGE_SECOND = 1u << 2,
+};
+
+const unsigned NONE = 0;
+const unsigned PROVEN = SELF_ATARI | MIRROR;
+const unsigned ALL = PROVEN | EDGE_SECOND;
+
+struct RuleInfo {
+    Rule rule;
+    const char* name;
+    bool proven;
+    int verified_up_to; // 経験則が完全解析と一致した最大の N (証明済みなら 0)
+    const char* statement;
+};
+
+// 規則の一覧 (MoveRules.cpp、main_rules の表示用)
+extern const RuleInfo RULES[];
+extern const int RULE_COUNT;
+
+// 自分が打ち終わった盤 (mine, empty) で、相手 (取った数 op_cap) が次の手で勝てるか
+inline bool loses_to_capture(uint64_t mine, uint64_t empty, int op_cap, int capture_target) {
+    return op_cap + 1 >= capture_target && bitutil::capture_points(mine, empty) != 0;
+}
+
+// 調べる必要のある手のマスク。左右対称な局面なら左半分、そうでなければ全部
+inline uint64_t mirror_filter(uint64_t my, uint64_t op, int n) {
+    if (bitutil::reverse_bits(my, n) != my || bitutil::reverse_bits(op, n) != op) return ~0ULL;
+    return (1ULL << ((n + 1) / 2)) - 1;
+}
+
+// 経験則で初手 idx の結果が決まるなら 'r' / 'g'、決まらなければ 0 (rules で有効なものだけ使う)
+inline char root_mark(unsigned rules, int n, int m, int idx) {
+    if ((rules & EDGE_SECOND) && m == 1 && n >= 5 && (idx == 1 || idx == n - 2)) return 'r';
+    return 0;
+}
+
+} // namespace moverules
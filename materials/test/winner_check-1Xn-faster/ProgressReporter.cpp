@@ -0,0 +1,126 @@
+#include "ProgressReporter.h"
+#include "MiniGoMT.h"
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+
+ProgressReporter::ProgressReporter(const MiniGoMT& s, const std::string& metrics_path, double interval_sec)
+    : solver(s), metrics(metrics_path, std::ios::app), interval(interval_sec) {
+    sweep_start = Clock::now();
+    worker = std::thread(&ProgressReporter::loop, this);
+}
+
+ProgressReporter::~ProgressReporter() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        stopping = true;
+    }
+    cv.notify_all();
+    worker.join();
+}
+
+void ProgressReporter::begin(int n, int last) {
+    std::lock_guard<std::mutex> lock(mtx);
+    cur_n = n;
+    last_n = last;
+    running = true;
+    cur_start = prev_time = Clock::now();
+    prev_nodes = 0;
+}
+
+void ProgressReporter::end(int n, double sec, uint64_t nodes) {
+    std::lock_guard<std::mutex> lock(mtx);
+    running = false;
+    // 続いている N だけを倍率の計算に使う
+    if (!history.empty() && history.back().n != n - 1) history.clear();
+    history.push_back({n, sec, nodes});
+
+    double total = std::chrono::duration<double>(Clock::now() - sweep_start).count();
+    metrics << "{\"event\": \"done\", \"t\": " << total << ", \"n\": " << n << ", \"sec\": " << sec
+            << ", \"nodes\": " << nodes << ", \"nodes_per_sec\": " << (sec > 0 ? nodes / sec : 0.0) << "}\n";
+    metrics.flush();
+}
+
+void ProgressReporter::loop() {
+    std::unique_lock<std::mutex> lock(mtx);
+    auto period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(interval));
+    while (!stopping) {
+        cv.wait_for(lock, period, [this] { return stopping; });
+        if (stopping) break;
+        if (running) sample();
+    }
+}
+
+bool ProgressReporter::growth(double& node_ratio, double& time_ratio) const {
+    // 小さい N は時間が測れないので、0.1 秒以上かかったものだけ使う
+    double log_nodes = 0, log_time = 0;
+    int count = 0;
+    for (size_t i = history.size() - 1; i >= 1 && count < 3; --i) {
+        const Finished& a = history[i - 1];
+        const Finished& b = history[i];
+        if (a.sec < 0.1 || a.nodes == 0) break;
+        log_nodes += std::log((double)b.nodes / (double)a.nodes);
+        log_time += std::log(b.sec / a.sec);
+        ++count;
+    }
+    if (count == 0) return false;
+    node_ratio = std::exp(log_nodes / count);
+    time_ratio = std::exp(log_time / count);
+    return true;
+}
+
+void ProgressReporter::sample() {
+    MiniGoMT::Progress p = solver.get_progress();
+    auto now = Clock::now();
+    double elapsed = std::chrono::duration<double>(now - cur_start).count();
+    double total = std::chrono::duration<double>(now - sweep_start).count();
+    double dt = std::chrono::duration<double>(now - prev_time).count();
+    double rate = (dt > 0 && p.nodes >= prev_nodes) ? (p.nodes - prev_nodes) / dt : 0.0;
+    prev_nodes = p.nodes;
+    prev_time = now;
+    double fill = p.tt_size ? (double)p.tt_filled / (double)p.tt_size : 0.0;
+
+    // この N の残り: 前の N のノード数 x 倍率 を今の速さで割る。
+    // 見込みを超えてしまったら、解き終わった初手の割合から粗く見積もり直す (まだ1つもなければ不明)
+    double eta_n = -1, eta_sweep = -1;
+    double node_ratio, time_ratio;
+    if (history.size() >= 2 && history.back().n == cur_n - 1 && growth(node_ratio, time_ratio)) {
+        const Finished& prev = history.back();
+        double expected_nodes = prev.nodes * node_ratio;
+        if (rate > 0 && p.nodes < expected_nodes) eta_n = (expected_nodes - p.nodes) / rate;
+        else if (p.moves_done > 0) eta_n = elapsed * (p.moves_total - p.moves_done) / p.moves_done;
+    }
+    if (eta_n >= 0) {
+        // 残りの N は1つごとに time_ratio 倍かかるとする
+        double t = elapsed + eta_n;
+        eta_sweep = eta_n;
+        for (int n = cur_n + 1; n <= last_n; ++n) {
+            t *= time_ratio;
+            eta_sweep += t;
+        }
+    }
+
+    std::ostringstream line;
+    line << "[N=" << cur_n << " " << format_duration(elapsed) << "] " << std::fixed << std::setprecision(1)
+         << p.nodes / 1e6 << "M nodes, " << rate / 1e6 << "M nodes/s, TT " << fill * 100 << "%, moves "
+         << p.moves_done << "/" << p.moves_total << ", ETA N=" << (eta_n < 0 ? "?" : format_duration(eta_n))
+         << ", sweep=" << (eta_sweep < 0 ? "?" : format_duration(eta_sweep));
+    std::cerr << line.str() << std::endl;
+
+    metrics << "{\"event\": \"sample\", \"t\": " << total << ", \"n\": " << cur_n << ", \"elapsed\": " << elapsed
+            << ", \"nodes\": " << p.nodes << ", \"nodes_per_sec\": " << rate << ", \"tt_fill\": " << fill
+            << ", \"moves_done\": " << p.moves_done << ", \"moves_total\": " << p.moves_total
+            << ", \"eta_n_sec\": " << eta_n << ", \"eta_sweep_sec\": " << eta_sweep << "}\n";
+    metrics.flush();
+}
+
+std::string ProgressReporter::format_duration(double sec) {
+    long long s = (long long)(sec + 0.5);
+    std::ostringstream os;
+    if (s >= 3600) os << s / 3600 << "h" << std::setw(2) << std::setfill('0') << (s % 3600) / 60 << "m";
+    else if (s >= 60) os << s / 60 << "m" << std::setw(2) << std::setfill('0') << s % 60 << "s";
+    else os << s << "s";
+    return os.str();
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <fstream>
+#include <chrono>
+
+class MiniGoMT;
+
+// 長い analyze_parallel の途中経過を表示するスレッド
+// interval 秒ごとに MiniGoMT::get_progress() を読んで、nodes/sec・置換表の埋まり具合・
+// 解き終わった初手の数・残り時間の見込みを標準エラーに出し、同じ内容を1行1JSONでファイルに追記する
+//
+// 残り時間は、これまでに解いた N のノード数と時間が N+1 ごとに何倍になったか (直近3つの幾何平均)
+// から外挿する。まだ N が2つ以上解けていなければ出さない
+class ProgressReporter {
+public:
+    ProgressReporter(const MiniGoMT& solver, const std::string& metrics_path, double interval_sec = 10.0);
+    ~ProgressReporter();
+    ProgressReporter(const ProgressReporter&) = delete;
+    ProgressReporter& operator=(const ProgressReporter&) = delete;
+
+    // N の解析を始める (last_n: この掃引で最後に解く N)
+    void begin(int n, int last_n);
+    // N の解析が終わった
+    void end(int n, double sec, uint64_t nodes);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Finished {
+        int n;
+        double sec;
+        uint64_t nodes;
+    };
+
+    const MiniGoMT& solver;
+    std::ofstream metrics;
+    double interval;
+
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool stopping = false;
+    bool running = false; // begin から end まで
+    int cur_n = 0;
+    int last_n = 0;
+    Clock::time_point cur_start;
+    Clock::time_point sweep_start;
+    std::vector<Finished> history;
+
+    // 前回の表示 (nodes/sec を区間で出すため)
+    uint64_t prev_nodes = 0;
+    Clock::time_point prev_time;
+
+    std::thread worker;
+
+    void loop();
+    void sample();
+    // 直近の N ごとの倍率 (ノード数, 時間)。求まらなければ false
+    bool growth(double& node_ratio, double& time_ratio) const;
+    static std::string format_duration(double sec);
+};
@@ -0,0 +1,99 @@
+#include "SearchStats.h"
+#include <algorithm>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace {
+
+// 生きているスレッドの統計と、終了したスレッドの統計の合計
+struct Registry {
+    std::mutex mtx;
+    std::vector<SearchStats*> live;
+    SearchStats retired;
+};
+
+Registry& registry() {
+    static Registry r;
+    return r;
+}
+
+// スレッドごとの置き場。スレッドが終わるときに合計へ足す
+struct LocalSlot {
+    SearchStats stats;
+    LocalSlot() {
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock(r.mtx);
+        r.live.push_back(&stats);
+    }
+    ~LocalSlot() {
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock(r.mtx);
+        r.retired.add(stats);
+        r.live.erase(std::find(r.live.begin(), r.live.end(), &stats));
+    }
+};
+
+// 末尾の0を省いて [a, b, ...] にする
+void write_array(std::ostringstream& os, const uint64_t* v, int size) {
+    int last = size;
+    while (last > 0 && v[last - 1] == 0) --last;
+    os << "[";
+    for (int i = 0; i < last; ++i) os << (i ? ", " : "") << v[i];
+    os << "]";
+}
+
+} // namespace
+
+uint64_t SearchStats::total_nodes() const {
+    uint64_t sum = 0;
+    for (int i = 0; i < MAX_PLY; ++i) sum += nodes[i];
+    return sum;
+}
+
+void SearchStats::add(const SearchStats& o) {
+    for (int i = 0; i < MAX_PLY; ++i) nodes[i] += o.nodes[i];
+    tt_probes += o.tt_probes;
+    tt_hits += o.tt_hits;
+    tt_collisions += o.tt_collisions;
+    tt_stores += o.tt_stores;
+    tt_overwrites += o.tt_overwrites;
+    for (int i = 0; i < MAX_RANK; ++i) cutoffs_by_rank[i] += o.cutoffs_by_rank[i];
+    for (int i = 0; i < 3; ++i) cutoffs_by_class[i] += o.cutoffs_by_class[i];
+    capture_wins += o.capture_wins;
+    etc_cutoffs += o.etc_cutoffs;
+}
+
+SearchStats& SearchStats::local() {
+    thread_local LocalSlot slot;
+    return slot.stats;
+}
+
+SearchStats SearchStats::collect() {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mtx);
+    SearchStats sum = r.retired;
+    for (const SearchStats* s : r.live) sum.add(*s);
+    return sum;
+}
+
+void SearchStats::reset() {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mtx);
+    r.retired = SearchStats();
+    for (SearchStats* s : r.live) *s = SearchStats();
+}
+
+std::string SearchStats::to_json() const {
+    std::ostringstream os;
+    os << "{\"nodes\": " << total_nodes() << ", \"nodes_per_ply\": ";
+    write_array(os, nodes, MAX_PLY);
+    os << ", \"tt_probes\": " << tt_probes << ", \"tt_hits\": " << tt_hits
+       << ", \"tt_collisions\": " << tt_collisions << ", \"tt_stores\": " << tt_stores
+       << ", \"tt_overwrites\": " << tt_overwrites << ", \"cutoffs_by_rank\": ";
+    write_array(os, cutoffs_by_rank, MAX_RANK);
+    os << ", \"cutoffs_by_class\": {\"op_adj\": " << cutoffs_by_class[OP_ADJ]
+       << ", \"my_adj\": " << cutoffs_by_class[MY_ADJ] << ", \"rest\": " << cutoffs_by_class[REST] << "}"
+       << ", \"capture_wins\": " << capture_wins << ", \"etc_cutoffs\": " << etc_cutoffs << "}";
+    return os.str();
+}
@@ -0,0 +1,84 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include "TTEntry.h"
+#include "BitUtil.h"
+
+// 探索の統計 (MiniGoBit, MiniGoMT)
+// -DMINIGO_STATS を付けてビルドしたときだけ数える。付けなければ MINIGO_STAT(...) は空になり、
+// 中の式もコンパイルされないので探索の速さは変わらない
+//   make solver3_stats   (Makefile 参照。main3 と同じソースに -DMINIGO_STATS を付ける)
+//
+// 数はスレッドごとの SearchStats に貯め (thread_local なので競合しない)、
+// collect() で全スレッドぶんを合計する。analyze_parallel のように std::async で作ったスレッドは
+// 終わるときに合計へ足し込まれる
+#ifdef MINIGO_STATS
+#define MINIGO_STAT(stmt) do { stmt; } while (0)
+#else
+#define MINIGO_STAT(stmt) do { } while (0)
+#endif
+
+struct SearchStats {
+    static const int MAX_PLY = 64;   // これより深い手数は最後の要素にまとめる
+    static const int MAX_RANK = 16;  // カットした手が何番目に調べた手か (これ以上はまとめる)
+
+    // 着手の分類 (MiniGoMT の Neighbor Priority と同じ)
+    enum MoveClass { OP_ADJ = 0, MY_ADJ = 1, REST = 2 };
+
+    uint64_t nodes[MAX_PLY] = {};
+    uint64_t tt_probes = 0;
+    uint64_t tt_hits = 0;
+    uint64_t tt_collisions = 0;  // 有効なエントリだがキーが違った
+    uint64_t tt_stores = 0;
+    uint64_t tt_overwrites = 0;  // 別の局面のエントリを上書きした
+    uint64_t cutoffs_by_rank[MAX_RANK] = {};
+    uint64_t cutoffs_by_class[3] = {};
+    uint64_t capture_wins = 0;   // m 個目を取ってその場で勝った手
+    uint64_t etc_cutoffs = 0;    // 置換表で負けと分かっている子があって再帰せずに勝った局面
+
+    // --- 探索中に呼ぶもの (MINIGO_STAT の中で使う) ---
+    void node(int ply) { ++nodes[ply < MAX_PLY ? ply : MAX_PLY - 1]; }
+    void probe(const TTEntry& e, uint64_t key) {
+        ++tt_probes;
+        if (!e.flag) return;
+        if (e.key == key) ++tt_hits;
+        else ++tt_collisions;
+    }
+    void store(const TTEntry& e, uint64_t key) {
+        ++tt_stores;
+        if (e.flag && e.key != key) ++tt_overwrites;
+    }
+    void cutoff(int rank, int cls) {
+        ++cutoffs_by_rank[rank < MAX_RANK ? rank : MAX_RANK - 1];
+        ++cutoffs_by_class[cls];
+    }
+    // 着手を c0, c1, c2 (OP_ADJ, MY_ADJ, REST) の順、各分類の中はビット順に調べたときのカット
+    void cutoff_ordered(uint64_t c0, uint64_t c1, uint64_t c2, uint64_t move_bit) {
+        uint64_t below = move_bit - 1;
+        if (c0 & move_bit) cutoff(bitutil::popcount(c0 & below), OP_ADJ);
+        else if (c1 & move_bit) cutoff(bitutil::popcount(c0) + bitutil::popcount(c1 & below), MY_ADJ);
+        else cutoff(bitutil::popcount(c0) + bitutil::popcount(c1) + bitutil::popcount(c2 & below), REST);
+    }
+    void capture_win() { ++capture_wins; }
+    void etc_cutoff() { ++etc_cutoffs; }
+
+    // 1xN 盤で move_bit がどの分類に入るか
+    static int move_class(uint64_t my, uint64_t op, uint64_t move_bit) {
+        if (((op << 1) | (op >> 1)) & move_bit) return OP_ADJ;
+        if (((my << 1) | (my >> 1)) & move_bit) return MY_ADJ;
+        return REST;
+    }
+
+    uint64_t total_nodes() const;
+    void add(const SearchStats& other);
+
+    // 今のスレッドの統計
+    static SearchStats& local();
+    // 全スレッドの合計 (探索スレッドが止まっているときに呼ぶこと)
+    static SearchStats collect();
+    // 全スレッドの統計を0に戻す
+    static void reset();
+
+    // {"nodes": ..., "nodes_per_ply": [...], ...} の1オブジェクト (改行なし)
+    std::string to_json() const;
+};
@@ -20,6 +20,8 @@ public:
     size_t get_node_count() const { return node_count; }
 
 private:
+    friend class KernelBench; // 計測用 (KernelBench.h)
+
     // --- Transposition Table ---
     std::unordered_map<HashKey, int> table;
 
@@ -0,0 +1,113 @@
+#include "SumGame.h"
+#include "BitUtil.h"
+#include <cassert>
+
+SumGame::SumGame(CGTEngine& e) : engine(e) {}
+
+void SumGame::prepare(const std::vector<RowPosition>& rows) {
+    int empties = 0;
+    for (const RowPosition& row : rows) {
+        if (!row.over) empties += row.n - bitutil::popcount(row.black | row.white);
+    }
+    if (empties + 1 <= capture_value) return;
+    // K が変わると全部の値が変わるので、Nごとのソルバーを作り直す
+    capture_value = empties + 1;
+    solvers.clear();
+}
+
+SumGame::Move SumGame::capture_move(const std::vector<RowPosition>& rows, bool black) {
+    for (size_t r = 0; r < rows.size(); ++r) {
+        const RowPosition& row = rows[r];
+        if (row.over) continue;
+        uint64_t mover = black ? row.black : row.white;
+        uint64_t other = black ? row.white : row.black;
+        for (uint64_t moves = ~(mover | other) & ((1ULL << row.n) - 1); moves; moves &= moves - 1) {
+            int idx = bitutil::lsb_index(moves);
+            if (bitutil::try_move(mover, other, idx, row.n) == bitutil::MOVE_CAPTURE) return {(int)r, idx, true};
+        }
+    }
+    return Move();
+}
+
+GameId SumGame::component_value(const RowPosition& row) {
+    // 石を取って終わった成分は 0
+    if (row.over) return engine.zero();
+
+    auto it = solvers.find(row.n);
+    if (it == solvers.end()) {
+        auto solver = std::make_unique<ValueSolver>(engine, capture_value);
+        // 呼ぶ側 (main_sum の parse_rows など) で 1..32 に収めておくこと
+        bool ok = solver->set_board_size(row.n);
+        assert(ok && "SumGame: row length must be 1..ValueSolver::MAX_N");
+        (void)ok;
+        it = solvers.emplace(row.n, std::move(solver)).first;
+    }
+    return it->second->value(row.black, row.white);
+}
+
+GameId SumGame::total_value(const std::vector<RowPosition>& rows) {
+    prepare(rows);
+    GameId total = engine.zero();
+    for (const RowPosition& row : rows) {
+        total = engine.add(total, component_value(row));
+    }
+    return total;
+}
+
+std::string SumGame::outcome_class(const std::vector<RowPosition>& rows) {
+    GameId total = total_value(rows);
+    // 先手で勝てるか: 今すぐ取れれば勝ち、そうでなければ値で決まる (黒: G |> 0, 白: G <| 0)
+    bool black_first = capture_move(rows, true).row >= 0 || !engine.le(total, engine.zero());
+    bool white_first = capture_move(rows, false).row >= 0 || !engine.le(engine.zero(), total);
+    if (black_first && white_first) return "N";
+    if (black_first) return "L";
+    if (white_first) return "R";
+    return "P";
+}
+
+SumGame::Move SumGame::best_move(const std::vector<RowPosition>& rows, bool black_to_move) {
+    // 取れる手があればそれで勝ち
+    Move capture = capture_move(rows, black_to_move);
+    if (capture.row >= 0) return capture;
+
+    prepare(rows);
+    size_t k = rows.size();
+    std::vector<GameId> values(k);
+    for (size_t r = 0; r < k; ++r) values[r] = component_value(rows[r]);
+
+    // others[r] = r 以外の成分の和 (前後からの累積和で作る)
+    std::vector<GameId> prefix(k + 1, engine.zero()), suffix(k + 1, engine.zero());
+    for (size_t r = 0; r < k; ++r) prefix[r + 1] = engine.add(prefix[r], values[r]);
+    for (size_t r = k; r > 0; --r) suffix[r - 1] = engine.add(suffix[r], values[r - 1]);
+
+    Move fallback;
+    for (size_t r = 0; r < k; ++r) {
+        const RowPosition& row = rows[r];
+        if (row.over) continue;
+        GameId others = engine.add(prefix[r], suffix[r + 1]);
+
+        uint64_t mover = black_to_move ? row.black : row.white;
+        uint64_t other = black_to_move ? row.white : row.black;
+        uint64_t moves = ~(mover | other) & ((1ULL << row.n) - 1);
+        while (moves) {
+            int idx = bitutil::lsb_index(moves);
+            moves &= moves - 1;
+
+            // 取れる手は上で返しているので、ここでは合法かどうかだけ
+            if (bitutil::try_move(mover, other, idx, row.n) == bitutil::MOVE_ILLEGAL) continue;
+
+            std::vector<RowPosition> next_rows = rows;
+            RowPosition& next = next_rows[r];
+            if (black_to_move) next.black |= 1ULL << idx;
+            else next.white |= 1ULL << idx;
+
+            // 打った後は相手番。相手が今すぐ取れず、先手で負ける (黒なら G' >= 0, 白なら G' <= 0) なら勝ち
+            GameId after = engine.add(others, component_value(next));
+            bool wins = capture_move(next_rows, !black_to_move).row < 0 &&
+                        (black_to_move ? engine.le(engine.zero(), after) : engine.le(after, engine.zero()));
+            if (wins) return {(int)r, idx, true};
+            if (fallback.row < 0) fallback = {(int)r, idx, false};
+        }
+    }
+    return fallback;
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include "CGTEngine.h"
+#include "SumSearch.h"
+#include "ValueSolver.h"
+#include <map>
+#include <memory>
+#include <vector>
+
+// 独立した複数の 1xN 盤面の直和 (README の「直和」: どこかで1つ取ったらゲーム全体の勝ち)
+// 積空間を探索せず、成分ごとの値 (Nごとの ValueSolver にキャッシュ) を足し合わせて判定する
+//
+// 取る手は整数 ±K (K = 全成分の空点の数 + 1 > 残り手数) への選択肢にする (ValueSolver の capture_value)。
+// 取った後に残りの成分で動く値は K より小さいので、先に取った側の勝ちになる。
+// ただし今すぐ取れる手が相手にもある局面では、値の上では取り返しと打ち消し合ってしまうので、
+// outcome_class / best_move は今すぐ取れる手を先に見る。
+// main_sum は空の列 2 つ (長さ 1..10) の 55 通りを SumSearch(true) の総当たりと突き合わせる
+class SumGame {
+public:
+    struct Move {
+        int row = -1;   // どの成分に打つか (-1 = 合法手なし)
+        int pos = -1;   // その成分のどこに打つか
+        bool winning = false;
+    };
+
+    explicit SumGame(CGTEngine& engine);
+
+    // 値は K = (これまでに渡した rows の空点の数の最大) + 1 で計算する (K が増えたらキャッシュを作り直す)
+    GameId component_value(const RowPosition& row);
+    GameId total_value(const std::vector<RowPosition>& rows);
+    int get_capture_value() const { return capture_value; }
+
+    // 帰結類 "L" "R" "P" "N" (左 = 黒)
+    std::string outcome_class(const std::vector<RowPosition>& rows);
+
+    // 勝てる手があればそれを、無ければ最初の合法手を返す
+    Move best_move(const std::vector<RowPosition>& rows, bool black_to_move);
+
+private:
+    CGTEngine& engine;
+    int capture_value = 1;
+    std::map<int, std::unique_ptr<ValueSolver>> solvers;
+
+    // rows の残り手数より大きい K にそろえる
+    void prepare(const std::vector<RowPosition>& rows);
+
+    // black の側が今すぐ取れる手 (row, pos) を返す (無ければ row = -1)
+    static Move capture_move(const std::vector<RowPosition>& rows, bool black);
+};
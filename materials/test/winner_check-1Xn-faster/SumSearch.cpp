@@ -0,0 +1,82 @@
+#include "SumSearch.h"
+#include "BitUtil.h"
+#include <cstddef>
+
+static uint64_t mix64(uint64_t x) {
+    // splitmix64
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+uint64_t SumSearch::hash_state(const std::vector<RowPosition>& rows, bool black_to_move) {
+    uint64_t h = black_to_move ? 0x12345ULL : 0x54321ULL;
+    for (const RowPosition& r : rows) {
+        h = mix64(h ^ (uint64_t)r.n);
+        uint64_t b = r.over ? ~0ULL : r.black;
+        uint64_t w = r.over ? ~0ULL : r.white;
+        h = mix64(h ^ b);
+        h = mix64(h ^ w);
+    }
+    return h;
+}
+
+bool SumSearch::win(std::vector<RowPosition>& rows, bool black_to_move) {
+    ++node_count;
+    uint64_t key = hash_state(rows, black_to_move);
+    auto it = memo.find(key);
+    if (it != memo.end()) return it->second;
+
+    bool result = false;
+    for (size_t r = 0; r < rows.size() && !result; ++r) {
+        RowPosition& row = rows[r];
+        if (row.over) continue;
+
+        uint64_t& mover = black_to_move ? row.black : row.white;
+        uint64_t other = black_to_move ? row.white : row.black;
+        uint64_t full_mask = (1ULL << row.n) - 1;
+        uint64_t moves = ~(mover | other) & full_mask;
+
+        while (moves && !result) {
+            int idx = bitutil::lsb_index(moves);
+            moves &= moves - 1;
+
+            bitutil::MoveResult mr = bitutil::try_move(mover, other, idx, row.n);
+            if (mr == bitutil::MOVE_ILLEGAL) continue;
+            if (mr == bitutil::MOVE_CAPTURE && capture_wins) {
+                result = true;
+                break;
+            }
+
+            // 成分の中だけ進めて、戻ってきたら元に戻す
+            uint64_t saved = mover;
+            mover |= 1ULL << idx;
+            if (mr == bitutil::MOVE_CAPTURE) row.over = true;
+
+            result = !win(rows, !black_to_move);
+
+            row.over = false;
+            mover = saved;
+        }
+    }
+
+    memo[key] = result;
+    return result;
+}
+
+bool SumSearch::first_player_wins(const std::vector<RowPosition>& rows, bool black_to_move) {
+    // 別の問題を続けて解くときにメモが膨らみ過ぎないようにする
+    if (memo.size() > (1u << 24)) memo.clear();
+    std::vector<RowPosition> work = rows;
+    return win(work, black_to_move);
+}
+
+char SumSearch::outcome_class(const std::vector<RowPosition>& rows) {
+    bool left_first = first_player_wins(rows, true);
+    bool right_first = first_player_wins(rows, false);
+    if (left_first && right_first) return 'N';
+    if (left_first) return 'L';
+    if (right_first) return 'R';
+    return 'P';
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// 独立した 1xN の列 (成分)
+// 石を取った成分はそこで終わり (over)、以後どちらも打てない
+struct RowPosition {
+    int n = 0;
+    uint64_t black = 0;
+    uint64_t white = 0;
+    bool over = false;
+
+    // 白黒を入れ替えた列 (-G)
+    RowPosition negated() const { return {n, white, black, over}; }
+};
+
+// 直和ゲームを積空間のまま総当たりで解く (検証・比較用)
+// 手番は「どれか1つの成分を選んでそこに打つ」。どの成分にも打てなければ負け
+//
+// capture_wins = false: 取った成分だけが終わる (RowPosition の over。CGT の値の足し算と同じ模型)
+// capture_wins = true : README の規則どおり、どの成分でも1つ取ったらその場でゲーム全体の勝ち
+class SumSearch {
+public:
+    explicit SumSearch(bool capture_wins_ = false) : capture_wins(capture_wins_) {}
+
+    // black_to_move の側が先に打って勝てるか
+    bool first_player_wins(const std::vector<RowPosition>& rows, bool black_to_move);
+
+    // 帰結類 "L" "R" "P" "N" (左 = 黒)
+    char outcome_class(const std::vector<RowPosition>& rows);
+
+    uint64_t get_node_count() const { return node_count; }
+
+private:
+    bool capture_wins;
+    std::unordered_map<uint64_t, bool> memo;
+    uint64_t node_count = 0;
+
+    bool win(std::vector<RowPosition>& rows, bool black_to_move);
+    static uint64_t hash_state(const std::vector<RowPosition>& rows, bool black_to_move);
+};
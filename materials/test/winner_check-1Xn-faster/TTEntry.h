@@ -0,0 +1,10 @@
+#pragma once
+#include <cstdint>
+
+// 置換表のエントリ (MiniGoBit, MiniGoMT で共通)
+struct TTEntry {
+    uint64_t key; // ハッシュキー (盤面ID)
+    int16_t score; // 評価値
+    uint8_t flag;  // 0:Empty, 1:Valid
+    uint8_t depth; // 保存したときの深さ (浅いほど部分木が大きい。2段目の置換表 DiskTT が使う)
+};
@@ -0,0 +1,202 @@
+#include "Thermograph.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+Trajectory Trajectory::constant(double value) {
+    Trajectory f;
+    f.t = {-1.0};
+    f.v = {value};
+    f.slope = {0};
+    return f;
+}
+
+static size_t segment_index(const Trajectory& f, double x) {
+    size_t i = 0;
+    while (i + 1 < f.t.size() && f.t[i + 1] <= x) ++i;
+    return i;
+}
+
+double Trajectory::at(double x) const {
+    size_t i = segment_index(*this, x);
+    return v[i] + slope[i] * (x - t[i]);
+}
+
+Trajectory Trajectory::shifted(int dslope) const {
+    Trajectory f = *this;
+    for (size_t i = 0; i < f.t.size(); ++i) {
+        f.v[i] += dslope * f.t[i];
+        f.slope[i] += dslope;
+    }
+    return f;
+}
+
+Trajectory Trajectory::truncated(double temp, double mast) const {
+    Trajectory f;
+    for (size_t i = 0; i < t.size() && t[i] < temp; ++i) {
+        f.t.push_back(t[i]);
+        f.v.push_back(v[i]);
+        f.slope.push_back(slope[i]);
+    }
+    f.t.push_back(std::max(temp, -1.0));
+    f.v.push_back(mast);
+    f.slope.push_back(0);
+    f.simplify();
+    return f;
+}
+
+void Trajectory::simplify() {
+    Trajectory f;
+    for (size_t i = 0; i < t.size(); ++i) {
+        // 長さ0の区間は後ろの区間で上書きする
+        if (!f.t.empty() && f.t.back() == t[i]) {
+            f.v.back() = v[i];
+            f.slope.back() = slope[i];
+        } else {
+            f.t.push_back(t[i]);
+            f.v.push_back(v[i]);
+            f.slope.push_back(slope[i]);
+        }
+        // 同じ直線の続きなら1区間にまとめる
+        size_t k = f.t.size();
+        if (k >= 2 && f.slope[k - 2] == f.slope[k - 1] &&
+            f.v[k - 2] + f.slope[k - 2] * (f.t[k - 1] - f.t[k - 2]) == f.v[k - 1]) {
+            f.t.pop_back();
+            f.v.pop_back();
+            f.slope.pop_back();
+        }
+    }
+    *this = f;
+}
+
+// a と b の上側 (take_max) または下側の包絡線
+static Trajectory envelope(const Trajectory& a, const Trajectory& b, bool take_max) {
+    std::vector<double> breaks = a.t;
+    breaks.insert(breaks.end(), b.t.begin(), b.t.end());
+    std::sort(breaks.begin(), breaks.end());
+    breaks.erase(std::unique(breaks.begin(), breaks.end()), breaks.end());
+
+    auto better = [&](double fa, int sa, double fb, int sb) {
+        // 同じ値なら、その先で勝つ方 (傾き) で決める
+        if (fa != fb) return take_max ? (fa > fb) : (fa < fb);
+        return take_max ? (sa >= sb) : (sa <= sb);
+    };
+
+    Trajectory f;
+    for (size_t k = 0; k < breaks.size(); ++k) {
+        double x0 = breaks[k];
+        double x1 = (k + 1 < breaks.size()) ? breaks[k + 1] : std::numeric_limits<double>::infinity();
+        size_t ia = segment_index(a, x0), ib = segment_index(b, x0);
+        double fa = a.at(x0), fb = b.at(x0);
+        int sa = a.slope[ia], sb = b.slope[ib];
+
+        bool use_a = better(fa, sa, fb, sb);
+        f.t.push_back(x0);
+        f.v.push_back(use_a ? fa : fb);
+        f.slope.push_back(use_a ? sa : sb);
+
+        // 区間内で交差したら乗り換える
+        if (sa != sb && fa != fb) {
+            double x = x0 + (fb - fa) / (double)(sa - sb);
+            if (x > x0 && x < x1) {
+                double fx = fa + sa * (x - x0);
+                f.t.push_back(x);
+                f.v.push_back(fx);
+                f.slope.push_back(use_a ? sb : sa);
+            }
+        }
+    }
+    f.simplify();
+    return f;
+}
+
+Trajectory Trajectory::max(const Trajectory& a, const Trajectory& b) { return envelope(a, b, true); }
+Trajectory Trajectory::min(const Trajectory& a, const Trajectory& b) { return envelope(a, b, false); }
+
+std::string Trajectory::to_string() const {
+    std::ostringstream os;
+    for (size_t i = 0; i < t.size(); ++i) {
+        os << "(" << t[i] << "," << v[i] << ")";
+    }
+    return os.str();
+}
+
+ThermoAnalyzer::ThermoAnalyzer(CGTEngine& e) : engine(e) {}
+
+const Thermograph& ThermoAnalyzer::thermograph(GameId g) {
+    auto it = cache.find(g);
+    if (it != cache.end()) return it->second;
+
+    Thermograph th;
+    if (engine.is_number(g) && engine.number_value(g) == std::floor(engine.number_value(g))) {
+        // 整数: 温度 -1 のマスト
+        double x = engine.number_value(g);
+        th.left_wall = th.right_wall = Trajectory::constant(x);
+        th.mean = th.left_stop = th.right_stop = x;
+        th.temperature = -1;
+        return cache.emplace(g, th).first->second;
+    }
+
+    // 足場: 左は max(GL の右壁) - t, 右は min(GR の左壁) + t
+    // 整数以外の標準形は左右どちらの選択肢も持つ
+    std::vector<GameId> left = engine.left_options(g);
+    std::vector<GameId> right = engine.right_options(g);
+
+    Trajectory left_scaffold, right_scaffold;
+    double lstop = -std::numeric_limits<double>::infinity();
+    double rstop = std::numeric_limits<double>::infinity();
+    for (size_t i = 0; i < left.size(); ++i) {
+        const Thermograph& opt = thermograph(left[i]);
+        Trajectory w = opt.right_wall.shifted(-1);
+        left_scaffold = (i == 0) ? w : Trajectory::max(left_scaffold, w);
+        lstop = std::max(lstop, opt.right_stop);
+    }
+    for (size_t i = 0; i < right.size(); ++i) {
+        const Thermograph& opt = thermograph(right[i]);
+        Trajectory w = opt.left_wall.shifted(+1);
+        right_scaffold = (i == 0) ? w : Trajectory::min(right_scaffold, w);
+        rstop = std::min(rstop, opt.left_stop);
+    }
+
+    // 足場の差 (左 - 右) は単調非増加。0以下になる最初の温度で壁が合流してマストになる
+    std::vector<double> breaks = left_scaffold.t;
+    breaks.insert(breaks.end(), right_scaffold.t.begin(), right_scaffold.t.end());
+    std::sort(breaks.begin(), breaks.end());
+    breaks.erase(std::unique(breaks.begin(), breaks.end()), breaks.end());
+
+    double temp = breaks.back();
+    double mast = (left_scaffold.at(temp) + right_scaffold.at(temp)) / 2;
+    for (size_t k = 0; k < breaks.size(); ++k) {
+        double x0 = breaks[k];
+        double x1 = (k + 1 < breaks.size()) ? breaks[k + 1] : std::numeric_limits<double>::infinity();
+        double d = left_scaffold.at(x0) - right_scaffold.at(x0);
+        if (d <= 0) {
+            temp = x0;
+            mast = (k == 0 && d < 0) ? (left_scaffold.at(x0) + right_scaffold.at(x0)) / 2 : left_scaffold.at(x0);
+            break;
+        }
+        int ds = left_scaffold.slope[segment_index(left_scaffold, x0)] -
+                 right_scaffold.slope[segment_index(right_scaffold, x0)];
+        if (ds < 0) {
+            double x = x0 + d / (double)(-ds);
+            if (x < x1) {
+                temp = x;
+                mast = left_scaffold.at(x);
+                break;
+            }
+        }
+    }
+
+    th.temperature = temp;
+    th.mean = mast;
+    th.left_wall = left_scaffold.truncated(temp, mast);
+    th.right_wall = right_scaffold.truncated(temp, mast);
+    if (engine.is_number(g)) {
+        th.left_stop = th.right_stop = engine.number_value(g);
+    } else {
+        th.left_stop = lstop;
+        th.right_stop = rstop;
+    }
+    return cache.emplace(g, th).first->second;
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include "CGTEngine.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// 温度 t (>= -1) に対する区分線形関数。壁 (wall) や足場 (scaffold) を表す
+// 1xN の値は二進分数なので double で誤差なく扱える
+struct Trajectory {
+    std::vector<double> t;   // 各区間の開始温度 (t[0] = -1)
+    std::vector<double> v;   // 開始点での値
+    std::vector<int> slope;  // 区間の傾き (最後の区間は無限に続く)
+
+    static Trajectory constant(double value);
+
+    double at(double x) const;
+    Trajectory shifted(int dslope) const;   // f(t) + dslope * t
+    Trajectory truncated(double temp, double mast) const;   // temp 以上を mast で一定にする
+
+    static Trajectory max(const Trajectory& a, const Trajectory& b);
+    static Trajectory min(const Trajectory& a, const Trajectory& b);
+
+    // 長さ0の区間や同じ直線の続きをまとめる
+    void simplify();
+
+    // "(t,v)(t,v)..." 形式の折れ点列
+    std::string to_string() const;
+};
+
+struct Thermograph {
+    Trajectory left_wall;
+    Trajectory right_wall;
+    double mean = 0;
+    double temperature = -1;
+    double left_stop = 0;
+    double right_stop = 0;
+};
+
+// ゲームの値 (GameId) ごとに温度図をキャッシュして計算する
+// ValueSolver は正規化した局面ごとに GameId を返すので、同じ値の局面は全て同じ結果を共有する
+class ThermoAnalyzer {
+public:
+    explicit ThermoAnalyzer(CGTEngine& engine);
+
+    const Thermograph& thermograph(GameId g);
+
+    size_t cache_size() const { return cache.size(); }
+
+private:
+    CGTEngine& engine;
+    std::unordered_map<GameId, Thermograph> cache;
+};
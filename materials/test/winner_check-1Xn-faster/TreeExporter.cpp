@@ -0,0 +1,197 @@
+#include "TreeExporter.h"
+#include "BitUtil.h"
+#include <algorithm>
+
+TreeExporter::TreeExporter(int n, int m)
+    : n_size(n), capture_target(std::max(1, std::min(m, 63))) {
+    full_mask = (n >= 64) ? ~0ULL : ((1ULL << n) - 1);
+    memo.resize(1 << 16);
+}
+
+// マス i の値 (黒 1, 白 -1, 空点 0)
+static inline int cell(uint64_t black, uint64_t white, int i) {
+    return ((black >> i) & 1) ? 1 : ((white >> i) & 1) ? -1 : 0;
+}
+
+TreeExporter::State TreeExporter::canonical(const State& s) const {
+    // 反転した盤の i 番目 = 元の盤の n-1-i 番目。最初に違うマスで比べる
+    for (int i = 0; i < n_size; ++i) {
+        int a = cell(s.black, s.white, i);
+        int b = cell(s.black, s.white, n_size - 1 - i);
+        if (a == b) continue;
+        if (b > a) return s;
+        State r = s;
+        r.black = bitutil::reverse_bits(s.black, n_size);
+        r.white = bitutil::reverse_bits(s.white, n_size);
+        return r;
+    }
+    return s; // 左右対称
+}
+
+// Solver::make_key と同じ形式 ("1:01-0" = 黒番、黒 1・白 -)。m > 1 なら取った数 ":黒,白" を付ける
+std::string TreeExporter::make_id(const State& s) const {
+    std::string id;
+    id.reserve(n_size + 8);
+    id += (s.player == 0) ? '1' : '2';
+    id += ':';
+    for (int i = 0; i < n_size; ++i) {
+        int v = cell(s.black, s.white, i);
+        id += (v == 1) ? '1' : (v == -1) ? '-' : '0';
+    }
+    if (capture_target > 1) {
+        id += ':' + std::to_string(s.black_cap) + ',' + std::to_string(s.white_cap);
+    }
+    return id;
+}
+
+void TreeExporter::fill_board(const State& s, std::vector<int>& board) const {
+    board.resize(n_size);
+    for (int i = 0; i < n_size; ++i) board[i] = cell(s.black, s.white, i);
+}
+
+std::string TreeExporter::root_id() const {
+    return make_id({0, 0, 0, 0, 0});
+}
+
+uint64_t TreeExporter::hash_state(const State& s) {
+    uint64_t x = s.black * 0x9E3779B97F4A7C15ULL ^ (s.white + 0x632BE59BD9B4E019ULL) * 0xBF58476D1CE4E5B9ULL;
+    x ^= ((uint64_t)s.black_cap << 16 | (uint64_t)s.white_cap << 8 | (uint64_t)s.player) * 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+    x *= 0xD6E8FEB86659FD93ULL;
+    return x ^ (x >> 32);
+}
+
+const TreeExporter::MemoEntry* TreeExporter::find(const State& s) const {
+    size_t mask = memo.size() - 1;
+    for (size_t i = hash_state(s) & mask;; i = (i + 1) & mask) {
+        const MemoEntry& e = memo[i];
+        if (e.result == 0) return nullptr;
+        if (e.black == s.black && e.white == s.white && e.black_cap == s.black_cap && e.white_cap == s.white_cap &&
+            e.player == s.player) {
+            return &e;
+        }
+    }
+}
+
+void TreeExporter::insert(const State& s, int result) {
+    if ((memo_used + 1) * 10 > memo.size() * 7) {
+        std::vector<MemoEntry> old(memo.size() * 2);
+        old.swap(memo);
+        memo_used = 0;
+        for (const MemoEntry& e : old) {
+            if (e.result != 0) insert({e.black, e.white, e.black_cap, e.white_cap, e.player}, e.result);
+        }
+    }
+    size_t mask = memo.size() - 1;
+    size_t i = hash_state(s) & mask;
+    while (memo[i].result != 0) i = (i + 1) & mask;
+    memo[i] = {s.black, s.white, (uint8_t)s.black_cap, (uint8_t)s.white_cap, (uint8_t)s.player, (int8_t)result};
+    ++memo_used;
+}
+
+TreeNodeRecord& TreeExporter::record_at(int depth) {
+    while ((int)records.size() <= depth) records.emplace_back(new TreeNodeRecord());
+    return *records[depth];
+}
+
+void TreeExporter::emit(const TreeNodeRecord& rec) {
+    ++summary.nodes;
+    summary.edges += rec.children.size();
+    if (rec.terminal) ++summary.terminal_nodes;
+    for (TreeWriter* w : writers) w->node(rec);
+}
+
+int TreeExporter::visit(const State& s, int depth) {
+    if (const MemoEntry* e = find(s)) return e->result;
+
+    const uint64_t mover = (s.player == 0) ? s.black : s.white;
+    const uint64_t other = (s.player == 0) ? s.white : s.black;
+    const int mover_cap = (s.player == 0) ? s.black_cap : s.white_cap;
+    const uint64_t empty = ~(s.black | s.white) & full_mask;
+
+    // 子を先に解くので、このノードのレコードは子の再帰が終わってから埋めきる
+    TreeNodeRecord* rec = &record_at(depth);
+    rec->children.clear();
+    bool win = false;
+
+    for (uint64_t e = empty; e; e &= e - 1) {
+        int idx = bitutil::lsb_index(e);
+        uint64_t move_bit = 1ULL << idx;
+        uint64_t next_empty = empty & ~move_bit;
+
+        uint64_t removed = 0;
+        if (idx > 0 && ((other >> (idx - 1)) & 1) && !bitutil::group_has_liberty(other, next_empty, idx - 1)) {
+            removed |= bitutil::group_mask(other, idx - 1);
+        }
+        if (idx < n_size - 1 && ((other >> (idx + 1)) & 1) &&
+            !bitutil::group_has_liberty(other, next_empty, idx + 1)) {
+            removed |= bitutil::group_mask(other, idx + 1);
+        }
+        if (!removed && !bitutil::group_has_liberty(mover | move_bit, next_empty, idx)) continue; // 自殺手
+
+        State child = s;
+        int next_cap = mover_cap + bitutil::popcount(removed);
+        if (s.player == 0) {
+            child.black = s.black | move_bit;
+            child.white = s.white & ~removed;
+            child.black_cap = next_cap;
+        } else {
+            child.white = s.white | move_bit;
+            child.black = s.black & ~removed;
+            child.white_cap = next_cap;
+        }
+        child.player = s.player ^ 1;
+        child = canonical(child);
+
+        int child_result;
+        if (next_cap >= capture_target) {
+            // m 個目を取った: 終局ノード (次の手番側の負け)
+            child_result = -1;
+            if (!find(child)) {
+                TreeNodeRecord& t = record_at(depth + 1);
+                t.id = make_id(child);
+                fill_board(child, t.board);
+                t.player_to_move = (child.player == 0) ? 1 : -1;
+                t.black_captures = child.black_cap;
+                t.white_captures = child.white_cap;
+                t.game_value = "Lost (Captured)";
+                t.outcome_class = "P";
+                t.terminal = true;
+                t.children.clear();
+                emit(t);
+                insert(child, -1);
+            }
+        } else {
+            child_result = visit(child, depth + 1);
+        }
+        rec->children.push_back({idx, make_id(child), child_result < 0});
+        if (child_result < 0) win = true;
+    }
+
+    rec->id = make_id(s);
+    fill_board(s, rec->board);
+    rec->player_to_move = (s.player == 0) ? 1 : -1;
+    rec->black_captures = s.black_cap;
+    rec->white_captures = s.white_cap;
+    rec->terminal = rec->children.empty();
+    rec->game_value = rec->terminal ? "Loss (No Moves)" : "UNKNOWN";
+    rec->outcome_class = win ? "N" : "P";
+    emit(*rec);
+
+    int result = win ? 1 : -1;
+    insert(s, result);
+    return result;
+}
+
+TreeExporter::Summary TreeExporter::run() {
+    summary = Summary();
+    std::fill(memo.begin(), memo.end(), MemoEntry{0, 0, 0, 0, 0, 0});
+    memo_used = 0;
+
+    std::string root = root_id();
+    for (TreeWriter* w : writers) w->begin(n_size, capture_target, root);
+    summary.root_result = visit({0, 0, 0, 0, 0}, 0);
+    for (TreeWriter* w : writers) w->end(summary.nodes, summary.edges);
+    summary.memo_bytes = memo.size() * sizeof(MemoEntry);
+    return summary;
+}
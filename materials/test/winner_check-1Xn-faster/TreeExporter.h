@@ -0,0 +1,76 @@
+#pragma once
+#include "TreeWriter.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// 1xN のゲーム木 (左右反転を同一視した DAG) を全部たどり、解き終わったノードから順に TreeWriter へ流す
+// winner_check-1Xn の Solver と同じ木 (取ったら終局のノードを含む、id も同じ形式) を、
+// GameNode を持たずにビットボードで作る。覚えておくのは 局面 -> 勝敗 の表 (1局面 24 バイト) だけ
+//
+// 取った数は局面に含める (取るたびに増えるだけなので、m > 1 でも同じ局面は二度現れず木は有限)。
+// 超コウは扱わない (MiniGoMT の既定と同じ)
+class TreeExporter {
+public:
+    struct Summary {
+        uint64_t nodes = 0;
+        uint64_t edges = 0;
+        uint64_t terminal_nodes = 0;
+        int root_result = 0;     // 根の手番 (黒) から見て 1=勝ち, -1=負け
+        size_t memo_bytes = 0;   // 勝敗の表の大きさ
+    };
+
+    TreeExporter(int n, int m);
+
+    void add_writer(TreeWriter* w) { writers.push_back(w); }
+
+    // 空の盤面 (黒番) から全部たどって書き出す
+    Summary run();
+
+    std::string root_id() const;
+
+private:
+    // 局面 (色は絶対。player: 0=黒番, 1=白番)
+    struct State {
+        uint64_t black, white;
+        int black_cap, white_cap;
+        int player;
+    };
+
+    struct MemoEntry {
+        uint64_t black, white;
+        uint8_t black_cap, white_cap;
+        uint8_t player;
+        int8_t result; // 0 = 空きスロット, それ以外は手番側から見た勝敗
+    };
+
+    int n_size;
+    int capture_target;
+    uint64_t full_mask;
+    std::vector<TreeWriter*> writers;
+
+    // 開番地法のハッシュ表。埋まりが 7 割を超えたら倍にする
+    std::vector<MemoEntry> memo;
+    size_t memo_used = 0;
+
+    // 深さごとの書き出し用レコード (再帰の中で使い回す)
+    std::vector<std::unique_ptr<TreeNodeRecord>> records;
+
+    Summary summary;
+
+    // 左右反転した方が (Solver と同じ辞書順で) 小さければ反転する
+    State canonical(const State& s) const;
+    std::string make_id(const State& s) const;
+    void fill_board(const State& s, std::vector<int>& board) const;
+
+    const MemoEntry* find(const State& s) const;
+    void insert(const State& s, int result);
+    static uint64_t hash_state(const State& s);
+
+    TreeNodeRecord& record_at(int depth);
+    void emit(const TreeNodeRecord& rec);
+
+    // s (正規形) を解いて書き出し、手番側から見た勝敗を返す
+    int visit(const State& s, int depth);
+};
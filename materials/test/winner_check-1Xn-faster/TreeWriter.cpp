@@ -0,0 +1,85 @@
+#include "TreeWriter.h"
+
+namespace {
+
+// 出力ファイルのバッファ (1MB)
+const size_t FILE_BUFFER_SIZE = 1 << 20;
+
+void write_board(std::ostream& os, const std::vector<int>& board) {
+    os << "[";
+    for (size_t i = 0; i < board.size(); ++i) os << (i ? ", " : "") << board[i];
+    os << "]";
+}
+
+// DOT のラベル用: 黒 X, 白 O, 空点 .
+std::string board_text(const std::vector<int>& board) {
+    std::string s;
+    for (int v : board) s += (v == 1) ? 'X' : (v == -1) ? 'O' : '.';
+    return s;
+}
+
+} // namespace
+
+StreamFile::StreamFile(const std::string& path) : buffer(FILE_BUFFER_SIZE) {
+    // バッファは open の前に設定する
+    ofs.rdbuf()->pubsetbuf(buffer.data(), (std::streamsize)buffer.size());
+    ofs.open(path);
+}
+
+void JsonTreeWriter::begin(int n, int m, const std::string& root_id) {
+    std::ostream& os = file.out();
+    os << "{\n  \"metadata\": {\n    \"n\": " << n << ",\n    \"m\": " << m << ",\n    \"root_node_id\": \""
+       << root_id << "\"\n  },\n  \"nodes\": {";
+}
+
+void JsonTreeWriter::node(const TreeNodeRecord& rec) {
+    std::ostream& os = file.out();
+    os << (first ? "\n" : ",\n") << "    \"" << rec.id << "\": {\"id\": \"" << rec.id << "\", \"board_state\": ";
+    first = false;
+    write_board(os, rec.board);
+    os << ", \"player_to_move\": " << rec.player_to_move << ", \"captures\": [" << rec.black_captures << ", "
+       << rec.white_captures << "], \"children\": {";
+    for (size_t i = 0; i < rec.children.size(); ++i) {
+        os << (i ? ", " : "") << "\"" << rec.children[i].move << "\": \"" << rec.children[i].id << "\"";
+    }
+    os << "}, \"optimal_moves\": [";
+    bool any = false;
+    for (const auto& c : rec.children) {
+        if (!c.optimal) continue;
+        os << (any ? ", " : "") << c.move;
+        any = true;
+    }
+    os << "], \"game_value\": \"" << rec.game_value << "\", \"outcome_class\": \"" << rec.outcome_class
+       << "\", \"is_optimal\": false}";
+}
+
+void JsonTreeWriter::end(uint64_t node_count, uint64_t edge_count) {
+    file.out() << "\n  },\n  \"summary\": {\"node_count\": " << node_count << ", \"edge_count\": " << edge_count
+               << "}\n}\n";
+    file.out().flush();
+}
+
+void DotTreeWriter::begin(int n, int m, const std::string& root_id) {
+    std::ostream& os = file.out();
+    os << "digraph GameTree {\n"
+       << "  label=\"1x" << n << " m=" << m << " root=" << root_id << "\";\n"
+       << "  node [shape=box, style=filled, fontsize=10];\n";
+}
+
+void DotTreeWriter::node(const TreeNodeRecord& rec) {
+    std::ostream& os = file.out();
+    const char* color = (rec.outcome_class == "P") ? "lightgreen" : (rec.outcome_class == "N") ? "orange" : "white";
+    os << "  \"" << rec.id << "\" [label=\"" << board_text(rec.board) << "\\n"
+       << (rec.player_to_move == 1 ? "Black" : "White") << " " << rec.outcome_class;
+    if (rec.terminal) os << "\\n" << rec.game_value;
+    os << "\", fillcolor=" << color << "];\n";
+    for (const auto& c : rec.children) {
+        os << "  \"" << rec.id << "\" -> \"" << c.id << "\" [label=\"" << c.move << "\""
+           << (c.optimal ? ", penwidth=3" : "") << "];\n";
+    }
+}
+
+void DotTreeWriter::end(uint64_t node_count, uint64_t edge_count) {
+    file.out() << "  // nodes=" << node_count << " edges=" << edge_count << "\n}\n";
+    file.out().flush();
+}
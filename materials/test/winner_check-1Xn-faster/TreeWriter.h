@@ -0,0 +1,81 @@
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// ゲーム木を、探索しながら1ノードずつファイルへ書き出す (木をメモリに持たない)
+// 形式は 仕様書.md の analysis_n{n}_m{m}.json と、Graphviz の DOT
+//
+// ノードは子を解き終わった時点 (帰結類が決まった時点) で渡されるので、子は必ず親より先に書かれる
+
+// 書き出す1ノード分 (TreeExporter が使い回すので、node() の中でだけ有効)
+struct TreeNodeRecord {
+    struct Child {
+        int move;       // 着手するマス (board の向きでの位置)
+        std::string id; // 子ノードの id
+        bool optimal;   // 最善手 (手番側が勝つ局面で、勝ちにつながる手)
+    };
+
+    std::string id;
+    std::vector<int> board;     // 0: 空点, 1: 黒, -1: 白
+    int player_to_move;         // 1: 黒, -1: 白
+    int black_captures;         // それぞれが取った石の数
+    int white_captures;
+    std::string game_value;     // 終局の理由 (終局でなければ "UNKNOWN")
+    std::string outcome_class;  // "N" = 手番側の勝ち, "P" = 手番側の負け
+    bool terminal;
+    std::vector<Child> children;
+};
+
+class TreeWriter {
+public:
+    virtual ~TreeWriter() {}
+    virtual void begin(int n, int m, const std::string& root_id) = 0;
+    virtual void node(const TreeNodeRecord& rec) = 0;
+    virtual void end(uint64_t node_count, uint64_t edge_count) = 0;
+};
+
+// 出力ファイル。大きめのバッファで書き、内容は溜め込まない
+class StreamFile {
+public:
+    explicit StreamFile(const std::string& path);
+    std::ofstream& out() { return ofs; }
+    bool ok() const { return (bool)ofs; }
+
+private:
+    std::vector<char> buffer;
+    std::ofstream ofs;
+};
+
+// { "metadata": {...}, "nodes": { id: {...}, ... }, "summary": {...} }
+// 仕様書のキーに加えて、ノードに optimal_moves (最善手の一覧) と captures を持たせる。
+// is_optimal (親から見た最善手か) は親が子より後に決まるので、各ノードでは常に false にして
+// 最善手は親側の optimal_moves で表す
+class JsonTreeWriter : public TreeWriter {
+public:
+    explicit JsonTreeWriter(const std::string& path) : file(path) {}
+    bool ok() const { return file.ok(); }
+
+    void begin(int n, int m, const std::string& root_id) override;
+    void node(const TreeNodeRecord& rec) override;
+    void end(uint64_t node_count, uint64_t edge_count) override;
+
+private:
+    StreamFile file;
+    bool first = true;
+};
+
+// ノードは帰結類で色分け (P=緑, N=橙)、最善手の辺は太線
+class DotTreeWriter : public TreeWriter {
+public:
+    explicit DotTreeWriter(const std::string& path) : file(path) {}
+    bool ok() const { return file.ok(); }
+
+    void begin(int n, int m, const std::string& root_id) override;
+    void node(const TreeNodeRecord& rec) override;
+    void end(uint64_t node_count, uint64_t edge_count) override;
+
+private:
+    StreamFile file;
+};
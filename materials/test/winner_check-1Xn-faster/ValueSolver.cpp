@@ -0,0 +1,67 @@
+#include "ValueSolver.h"
+#include "BitUtil.h"
+#include <algorithm>
+
+ValueSolver::ValueSolver(CGTEngine& e, int capture_value)
+    : engine(e), black_capture(e.integer(capture_value)), white_capture(e.integer(-capture_value)) {}
+
+bool ValueSolver::set_board_size(int n) {
+    if (n < 1 || n > MAX_N) return false;
+    if (n == n_size) return true;
+    n_size = n;
+    full_mask = (1ULL << n_size) - 1;
+    memo.clear();
+    return true;
+}
+
+uint64_t ValueSolver::canonical_key(uint64_t black, uint64_t white) const {
+    uint64_t k1 = (black << 32) | white;
+    uint64_t k2 = (bitutil::reverse_bits(black, n_size) << 32) | bitutil::reverse_bits(white, n_size);
+    return std::min(k1, k2);
+}
+
+void ValueSolver::collect_options(uint64_t mover, uint64_t other, bool mover_is_black, std::vector<GameId>& out) {
+    uint64_t empty = ~(mover | other) & full_mask;
+    uint64_t moves = empty;
+    while (moves) {
+        int idx = bitutil::lsb_index(moves);
+        uint64_t move_bit = 1ULL << idx;
+        moves &= moves - 1;
+
+        // 相手の連を取ったら終局、自殺手は打てない
+        bitutil::MoveResult result = bitutil::try_move(mover, other, idx, n_size);
+        if (result == bitutil::MOVE_ILLEGAL) continue;
+        if (result == bitutil::MOVE_CAPTURE) {
+            out.push_back(mover_is_black ? black_capture : white_capture);
+            continue;
+        }
+
+        uint64_t next_mover = mover | move_bit;
+        if (mover_is_black) out.push_back(value(next_mover, other));
+        else out.push_back(value(other, next_mover));
+    }
+}
+
+GameId ValueSolver::value(uint64_t black, uint64_t white) {
+    uint64_t key = canonical_key(black, white);
+    auto it = memo.find(key);
+    if (it != memo.end()) return it->second;
+
+    std::vector<GameId> left, right;
+    collect_options(black, white, true, left);
+    collect_options(white, black, false, right);
+
+    GameId g = engine.make(left, right);
+    memo[key] = g;
+    return g;
+}
+
+GameId ValueSolver::value(const std::vector<int>& board) {
+    if (!set_board_size((int)board.size())) return INVALID_ID;
+    uint64_t black = 0, white = 0;
+    for (int i = 0; i < n_size; ++i) {
+        if (board[i] == 1) black |= 1ULL << i;
+        else if (board[i] == -1) white |= 1ULL << i;
+    }
+    return value(black, white);
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include "CGTEngine.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// 1xN 盤面のゲームの値を CGTEngine で計算する
+// 左 = 黒 (1), 右 = 白 (-1)。手番は値に含まれない (両者の選択肢を持つ)
+// 石を取る手は終局 (どちらも着手なし = 0) への選択肢として扱う。
+// 単独の盤面では「取ったら勝ち」「打てなければ負け」とソルバーの勝敗が一致する
+//
+// capture_value = K (> 0) にすると、取る手は黒なら整数 K、白なら -K への選択肢になる。
+// K が和の残り手数より大きければ、取った側がそのまま勝つ (SumGame が README の直和の規則に使う)
+class ValueSolver {
+public:
+    explicit ValueSolver(CGTEngine& engine, int capture_value = 0);
+
+    // キーは黒32bit + 白32bit なので N は 32 まで
+    static const int MAX_N = 32;
+
+    // Nが変わったときだけメモをクリアする (CGTEngine側の値は共有したまま)
+    // n が 1..MAX_N でなければ false を返し、盤の大きさは変えない
+    bool set_board_size(int n);
+    int get_board_size() const { return n_size; }
+
+    // black/white: 石のビットボード
+    GameId value(uint64_t black, uint64_t white);
+
+    // 0:空, 1:黒, -1:白 の盤面から。盤の長さが 1..MAX_N でなければ INVALID_ID
+    static const GameId INVALID_ID = -1;
+    GameId value(const std::vector<int>& board);
+
+    size_t memo_size() const { return memo.size(); }
+
+    // メモにある全局面 (左右反転で正規化済み) を f(black, white, value) で列挙する
+    template <class F>
+    void for_each_position(F f) const {
+        for (const auto& [key, g] : memo) f(key >> 32, key & 0xFFFFFFFFULL, g);
+    }
+
+private:
+    CGTEngine& engine;
+    GameId black_capture; // 黒/白が取ったときの行き先 (0 か ±K)
+    GameId white_capture;
+    int n_size = 0;
+    uint64_t full_mask = 0;
+
+    // 盤面 (左右反転で正規化) -> 値。転置した局面は同じ値を共有する
+    std::unordered_map<uint64_t, GameId> memo;
+
+    uint64_t canonical_key(uint64_t black, uint64_t white) const;
+
+    // mover が打てる手の行き先を out に追加する
+    void collect_options(uint64_t mover, uint64_t other, bool mover_is_black, std::vector<GameId>& out);
+};
@@ -1,36 +1,59 @@
 #include "MiniGoBit.h"
+#include "SearchStats.h"
 #include <iostream>
 #include <fstream>
 #include <chrono>
 
 int main() {
-    int from, to;
+    int from, to, m;
     std::cout << "1xN MiniGo Solver (Bitboard Optimized)\n";
     std::cout << "Enter range N (e.g. 1 40)\n";
     std::cout << "From: ";
     std::cin >> from;
     std::cout << "To: ";
     std::cin >> to;
+    std::cout << "m (capture target): ";
+    std::cin >> m;
 
-    std::string filename = "analysis_bit_" + std::to_string(from) + "-" + std::to_string(to) + ".csv";
+    // m=1 のときは従来と同じファイル名
+    std::string m_suffix = (m > 1) ? "_m" + std::to_string(m) : "";
+    std::string filename = "analysis_bit_" + std::to_string(from) + "-" + std::to_string(to) + m_suffix + ".csv";
     std::ofstream ofs(filename);
+#ifdef MINIGO_STATS
+    // 探索の統計は N ごとに1行ずつ、CSV と同じ名前の .json に書く
+    std::string stats_filename = filename.substr(0, filename.size() - 4) + "_stats.json";
+    std::ofstream stats_ofs(stats_filename);
+    stats_ofs << "{\"runs\": [\n";
+#endif
     ofs << "N,Result_Map\n";
 
     // ソルバーの初期化 (メモリ確保はここでのみ行われる)
     MiniGoBit solver;
 
     for (int n = from; n <= to; ++n) {
+        MINIGO_STAT(SearchStats::reset());
         auto start = std::chrono::high_resolution_clock::now();
         
-        std::string res = solver.analyze(n);
+        std::string res = solver.analyze(n, m);
         
         auto end = std::chrono::high_resolution_clock::now();
         double sec = std::chrono::duration<double>(end - start).count();
 
         std::cout << "N=" << n << " : [" << res << "] (" << sec << "s)\n";
         ofs << n << "," << res << "\n";
+#ifdef MINIGO_STATS
+        SearchStats stats = SearchStats::collect();
+        std::cout << "  nodes=" << stats.total_nodes() << " tt_hits=" << stats.tt_hits << "/" << stats.tt_probes
+                  << " collisions=" << stats.tt_collisions << "\n";
+        stats_ofs << "  {\"n\": " << n << ", \"sec\": " << sec << ", \"stats\": " << stats.to_json() << "}"
+                  << (n < to ? "," : "") << "\n";
+#endif
     }
 
     std::cout << "Done. Saved to " << filename << "\n";
+#ifdef MINIGO_STATS
+    stats_ofs << "]}\n";
+    std::cout << "Stats saved to " << stats_filename << "\n";
+#endif
     return 0;
 }
\ No newline at end of file
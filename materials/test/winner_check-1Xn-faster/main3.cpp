@@ -1,35 +1,82 @@
 #include "MiniGoMT.h"
+#include "SearchStats.h"
+#include "ProgressReporter.h"
 #include <iostream>
 #include <fstream>
 #include <chrono>
 #include <thread>
 
 int main() {
-    int from, to;
+    int from, to, m, superko = 0, disk_gb = 0, disk_depth = 8;
     std::cout << "1xN MiniGo Solver (Parallel + Bitboard)\n";
     std::cout << "CPU Cores: " << std::thread::hardware_concurrency() << "\n";
     std::cout << "From: "; std::cin >> from;
     std::cout << "To: "; std::cin >> to;
+    std::cout << "m (capture target): "; std::cin >> m;
+    // m=1 では局面が繰り返さないので聞かない
+    if (m > 1) { std::cout << "Superko (0/1): "; std::cin >> superko; }
+    // 2段目の置換表 (ローカルディスクのファイル)。RAM の表が足りない大きな N 用
+    std::cout << "Disk TT size in GB (0 = off): "; std::cin >> disk_gb;
+    if (disk_gb > 0) { std::cout << "Disk TT max depth (e.g. 8): "; std::cin >> disk_depth; }
 
     // メモリ量に合わせてTTサイズビット数を調整 (27 = 2GB, 24 = 256MB)
     // お使いのPCメモリが16GB以上なら 27 か 28 を推奨
     MiniGoMT solver(28); 
+    solver.set_superko(superko != 0);
+    if (disk_gb > 0) {
+        int disk_bits = 26; // 1GB = 2^26 エントリ
+        while ((1LL << (disk_bits - 26)) * 2 <= disk_gb) ++disk_bits;
+        if (!solver.enable_disk_tt("minigo_tt2.bin", disk_bits, disk_depth)) {
+            std::cout << "Cannot create minigo_tt2.bin, running without disk TT\n";
+        }
+    }
 
-    std::string filename = "analysis_mt_" + std::to_string(from) + "-" + std::to_string(to) + ".csv";
+    // m=1 のときは従来と同じファイル名
+    std::string m_suffix = (m > 1) ? "_m" + std::to_string(m) : "";
+    if (m > 1 && superko) m_suffix += "_sk";
+    std::string filename = "analysis_mt_" + std::to_string(from) + "-" + std::to_string(to) + m_suffix + ".csv";
     std::ofstream ofs(filename);
+#ifdef MINIGO_STATS
+    // 探索の統計は N ごとに1行ずつ、CSV と同じ名前の .json に書く
+    std::string stats_filename = filename.substr(0, filename.size() - 4) + "_stats.json";
+    std::ofstream stats_ofs(stats_filename);
+    stats_ofs << "{\"runs\": [\n";
+#endif
     ofs << "N,Result\n";
 
+    // 10秒ごとに途中経過を標準エラーへ出し、_metrics.jsonl に追記する
+    std::string metrics_filename = filename.substr(0, filename.size() - 4) + "_metrics.jsonl";
+    ProgressReporter progress(solver, metrics_filename, 10.0);
+
     for (int n = from; n <= to; ++n) {
+        MINIGO_STAT(SearchStats::reset());
+        progress.begin(n, to);
         auto start = std::chrono::high_resolution_clock::now();
         
         // 並列解析実行
-        std::string res = solver.analyze_parallel(n);
+        std::string res = solver.analyze_parallel(n, m);
         
         auto end = std::chrono::high_resolution_clock::now();
         double sec = std::chrono::duration<double>(end - start).count();
+        progress.end(n, sec, solver.get_progress().nodes);
 
         std::cout << "N=" << n << " : [" << res << "] (" << sec << "s)\n";
+        if (solver.get_disk_tt().is_open()) {
+            const DiskTT& d = solver.get_disk_tt();
+            std::cout << "  disk tt: hits=" << d.hits() << "/" << d.probes() << " stores=" << d.stores() << "\n";
+        }
         ofs << n << "," << res << "\n";
+#ifdef MINIGO_STATS
+        SearchStats stats = SearchStats::collect();
+        std::cout << "  nodes=" << stats.total_nodes() << " tt_hits=" << stats.tt_hits << "/" << stats.tt_probes
+                  << " collisions=" << stats.tt_collisions << "\n";
+        stats_ofs << "  {\"n\": " << n << ", \"sec\": " << sec << ", \"stats\": " << stats.to_json() << "}"
+                  << (n < to ? "," : "") << "\n";
+#endif
     }
+#ifdef MINIGO_STATS
+    stats_ofs << "]}\n";
+    std::cout << "Stats saved to " << stats_filename << "\n";
+#endif
     return 0;
 }
\ No newline at end of file
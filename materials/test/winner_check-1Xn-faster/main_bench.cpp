@@ -0,0 +1,67 @@
+#include "KernelBench.h"
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <cstdlib>
+#include <cstring>
+
+// 小さな処理ごとのベンチマーク (ビルド: make bench)
+// 使い方: bench [--json 出力先] [--baseline 比較するJSON] [--iterations 回数] [--solver-n N] [--label 名前]
+//   例: bench --baseline bench_baseline.json
+// 出力JSONを --baseline に渡すと、変更前後の ns/op の比 (新/旧) を並べて表示する
+int main(int argc, char** argv) {
+    std::string json_path = "bench_result.json";
+    std::string baseline_path;
+    std::string label = "local";
+    int iterations = 200;
+    int solver_n = 16;
+
+    for (int i = 1; i < argc; ++i) {
+        bool has_value = (i + 1 < argc);
+        if (std::strcmp(argv[i], "--json") == 0 && has_value) json_path = argv[++i];
+        else if (std::strcmp(argv[i], "--baseline") == 0 && has_value) baseline_path = argv[++i];
+        else if (std::strcmp(argv[i], "--iterations") == 0 && has_value) iterations = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--solver-n") == 0 && has_value) solver_n = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--label") == 0 && has_value) label = argv[++i];
+        else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--json out.json] [--baseline base.json] [--iterations K] [--solver-n N] [--label NAME]\n";
+            return 1;
+        }
+    }
+
+    // N=4..40 のランダムな局面 (シード固定なので毎回同じ)
+    auto corpus = KernelBench::make_corpus(4096, 4, 40, 20240601);
+    auto results = KernelBench::run_kernels(corpus, iterations);
+    auto solvers = KernelBench::run_solvers(solver_n);
+    results.insert(results.end(), solvers.begin(), solvers.end());
+
+    std::vector<std::pair<std::string, double>> baseline;
+    if (!baseline_path.empty()) {
+        baseline = KernelBench::load_baseline(baseline_path);
+        if (baseline.empty()) std::cerr << "Warning: no results in " << baseline_path << "\n";
+    }
+
+    std::cout << std::left << std::setw(36) << "kernel" << std::right << std::setw(14) << "ns/op"
+              << std::setw(16) << "ops/sec";
+    if (!baseline.empty()) std::cout << std::setw(14) << "base ns/op" << std::setw(10) << "ratio";
+    std::cout << "\n";
+
+    for (const auto& r : results) {
+        std::cout << std::left << std::setw(36) << r.name << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(14) << r.ns_per_op << std::setprecision(0) << std::setw(16) << r.ops_per_sec;
+        for (const auto& b : baseline) {
+            if (b.first != r.name || b.second <= 0.0) continue;
+            // ratio > 1 なら基準より遅い
+            std::cout << std::setprecision(2) << std::setw(14) << b.second << std::setw(10)
+                      << r.ns_per_op / b.second;
+            break;
+        }
+        std::cout << "\n";
+    }
+
+    std::ofstream ofs(json_path);
+    ofs << KernelBench::to_json(results, label);
+    std::cout << "Saved to " << json_path << "\n";
+    return 0;
+}
@@ -0,0 +1,53 @@
+#include "ValueSolver.h"
+#include <iostream>
+#include <fstream>
+#include <chrono>
+
+int main() {
+    int from, to;
+    std::cout << "1xN MiniGo Game Value (Canonical Form)\n";
+    std::cout << "From: "; std::cin >> from;
+    std::cout << "To: "; std::cin >> to;
+    if (from < 1 || to > ValueSolver::MAX_N || from > to) {
+        std::cout << "N must be 1.." << ValueSolver::MAX_N << "\n";
+        return 1;
+    }
+
+    std::string filename = "cgt_values_" + std::to_string(from) + "-" + std::to_string(to) + ".csv";
+    std::ofstream ofs(filename);
+    ofs << "N,Value,Outcome,FirstMoves\n";
+
+    // 値は全てのNで共有する (同じ値は同じノード)
+    CGTEngine engine;
+    ValueSolver solver(engine);
+
+    for (int n = from; n <= to; ++n) {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        solver.set_board_size(n);
+        GameId root = solver.value(0, 0);
+
+        // 黒の初手ごとの値 (白番で見た局面の値)。自殺手は x、取って終局なら 0
+        std::string first_moves;
+        for (int i = 0; i < n; ++i) {
+            if (i) first_moves += " ";
+            uint64_t move_bit = 1ULL << i;
+            bool suicide = (n == 1);
+            first_moves += suicide ? "x" : engine.to_string(solver.value(move_bit, 0));
+        }
+
+        auto end = std::chrono::high_resolution_clock::now();
+        double sec = std::chrono::duration<double>(end - start).count();
+
+        std::cout << "N=" << n << " : " << engine.to_string(root)
+                  << " [" << engine.outcome_class(root) << "]"
+                  << " (positions: " << solver.memo_size()
+                  << ", values: " << engine.size()
+                  << ", " << sec << "s)\n";
+        ofs << n << ",\"" << engine.to_string(root) << "\"," << engine.outcome_class(root)
+            << ",\"" << first_moves << "\"\n";
+    }
+
+    std::cout << "Done. Saved to " << filename << "\n";
+    return 0;
+}
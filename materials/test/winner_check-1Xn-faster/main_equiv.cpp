@@ -0,0 +1,69 @@
+#include "EquivFinder.h"
+#include "ValueSolver.h"
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <thread>
+#include <algorithm>
+
+int main() {
+    int max_n, verify_n;
+    std::cout << "1xN MiniGo Equivalence Classes (value(G) = value(H))\n";
+    std::cout << "CPU Cores: " << std::thread::hardware_concurrency() << "\n";
+    std::cout << "Max N: "; std::cin >> max_n;
+    std::cout << "Verify G-H up to N: "; std::cin >> verify_n;
+    if (max_n < 1 || max_n > ValueSolver::MAX_N) {
+        std::cout << "N must be 1.." << ValueSolver::MAX_N << "\n";
+        return 1;
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    CGTEngine engine;
+    EquivFinder finder(engine);
+    finder.collect(max_n);
+
+    auto mid = std::chrono::high_resolution_clock::now();
+    std::cout << "Positions: " << finder.num_positions()
+              << ", classes: " << finder.classes().size()
+              << " (" << std::chrono::duration<double>(mid - start).count() << "s)\n";
+
+    // 同値類の一覧 (大きい順)
+    std::vector<std::pair<size_t, GameId>> order;
+    for (const auto& [g, members] : finder.classes()) order.emplace_back(members.size(), g);
+    std::sort(order.rbegin(), order.rend());
+
+    std::string suffix = "1-" + std::to_string(max_n) + ".csv";
+    std::ofstream classes_ofs("equiv_classes_" + suffix);
+    std::ofstream members_ofs("equiv_members_" + suffix);
+    classes_ofs << "ClassId,Value,Outcome,Size,Representative\n";
+    members_ofs << "ClassId,N,RawBoard\n";
+
+    for (size_t c = 0; c < order.size(); ++c) {
+        GameId g = order[c].second;
+        const auto& members = finder.classes().at(g);
+        classes_ofs << c << ",\"" << engine.to_string(g) << "\"," << engine.outcome_class(g) << ","
+                    << members.size() << ",\"" << EquivFinder::board_string(members[0]) << "\"\n";
+        for (const RowPosition& p : members) {
+            members_ofs << c << "," << p.n << ",\"" << EquivFinder::board_string(p) << "\"\n";
+        }
+        if (c < 10) {
+            std::cout << "  class " << c << ": " << engine.to_string(g)
+                      << " x" << members.size() << "\n";
+        }
+    }
+
+    // G + (-H) の検証
+    int threads = std::max(1u, std::thread::hardware_concurrency());
+    EquivFinder::VerifyResult res = finder.verify(verify_n, 100, threads);
+
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << "Verified G-H: " << res.passed << "/" << res.checked << " are P"
+              << " (" << std::chrono::duration<double>(end - mid).count() << "s)\n";
+    for (const auto& [g, h] : res.failures) {
+        std::cout << "  FAIL: [" << EquivFinder::board_string(g) << "] - ["
+                  << EquivFinder::board_string(h) << "]\n";
+    }
+    std::cout << "Done. Saved to equiv_classes_" << suffix << " / equiv_members_" << suffix << "\n";
+    return res.failures.empty() ? 0 : 1;
+}
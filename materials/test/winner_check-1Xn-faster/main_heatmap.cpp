@@ -0,0 +1,46 @@
+#include "HeatmapGenerator.h"
+#include <iostream>
+#include <fstream>
+#include <chrono>
+
+// ヒートマップ用のデータを N の範囲でまとめて CSV に書く (compare_N.py / heat-map-go はこれを読んで描くだけ)
+int main() {
+    int from, to, m, mode;
+    std::cout << "1xN heatmap data generator\n";
+    std::cout << "From: "; if (!(std::cin >> from)) return 0;
+    std::cout << "To: "; if (!(std::cin >> to)) return 0;
+    std::cout << "m (capture target): "; if (!(std::cin >> m)) return 0;
+    std::cout << "Positions (0 = empty board, 1 = all reachable): "; if (!(std::cin >> mode)) return 0;
+    if (from < 1 || to > 63 || from > to) {
+        std::cout << "N must be 1..63\n";
+        return 1;
+    }
+
+    HeatmapGenerator gen(m);
+    std::cout << "Threads: " << gen.thread_count() << "\n";
+
+    std::string m_suffix = (m > 1) ? "_m" + std::to_string(m) : "";
+    std::string mode_suffix = (mode == 1) ? "_all" : "";
+    std::string filename =
+        "heatmap_" + std::to_string(from) + "-" + std::to_string(to) + m_suffix + mode_suffix + ".csv";
+    std::ofstream ofs(filename);
+    HeatmapGenerator::write_header(ofs);
+
+    for (int n = from; n <= to; ++n) {
+        auto start = std::chrono::high_resolution_clock::now();
+        std::vector<HeatmapGenerator::Row> rows;
+        if (mode == 1) rows = gen.all_positions(n);
+        else rows.push_back(gen.first_moves(n));
+        auto end = std::chrono::high_resolution_clock::now();
+        double sec = std::chrono::duration<double>(end - start).count();
+
+        HeatmapGenerator::write_rows(ofs, n, rows);
+        ofs.flush();
+        std::cout << "N=" << n << " : ";
+        if (mode == 1) std::cout << rows.size() << " positions";
+        else std::cout << "[" << rows[0].cells << "]";
+        std::cout << " (" << sec << "s)\n";
+    }
+    std::cout << "Saved to " << filename << "\n";
+    return 0;
+}
@@ -0,0 +1,52 @@
+#include "MiniGoMCTS.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <chrono>
+#include <thread>
+#include <algorithm>
+
+int main() {
+    int from, to, m;
+    uint64_t playouts;
+    std::cout << "1xN MiniGo MCTS (UCT + RAVE, approximate)\n";
+    std::cout << "CPU Cores: " << std::thread::hardware_concurrency() << "\n";
+    std::cout << "From: "; std::cin >> from;
+    std::cout << "To: "; std::cin >> to;
+    std::cout << "m (capture target): "; std::cin >> m;
+    std::cout << "Playouts per first move (e.g. 200000): "; std::cin >> playouts;
+
+    // 木は 2^21 ノード (96MB)。足りなくなった枝はプレイアウトだけで評価を続ける
+    MiniGoMCTS mcts(1 << 21);
+
+    std::string m_suffix = (m > 1) ? "_m" + std::to_string(m) : "";
+    std::string filename = "analysis_mcts_" + std::to_string(from) + "-" + std::to_string(to) + m_suffix + ".csv";
+    std::ofstream ofs(filename);
+    // MinSeparation: 初手ごとの MoveEval::separation の最小値 (z 値の目安で、誤り率ではない)
+    // WinRates: 初手ごとの推定勝率 (確定した手は末尾に '*')
+    ofs << "N,Result,MinSeparation,WinRates\n";
+
+    for (int n = from; n <= to; ++n) {
+        auto start = std::chrono::high_resolution_clock::now();
+        auto evals = mcts.analyze(n, m, playouts);
+        auto end = std::chrono::high_resolution_clock::now();
+        double sec = std::chrono::duration<double>(end - start).count();
+
+        std::string res = MiniGoMCTS::to_map(evals);
+        double min_sep = 1.0;
+        std::ostringstream rates;
+        rates << std::fixed << std::setprecision(3);
+        for (size_t i = 0; i < evals.size(); ++i) {
+            min_sep = std::min(min_sep, evals[i].separation);
+            rates << (i ? " " : "") << evals[i].win_rate << (evals[i].proven ? "*" : "");
+        }
+
+        std::cout << "N=" << n << " : [" << res << "] min_sep=" << std::fixed << std::setprecision(3) << min_sep
+                  << std::defaultfloat << " (" << sec << "s)\n";
+        ofs << n << "," << res << "," << min_sep << "," << rates.str() << "\n";
+    }
+
+    std::cout << "Done. Saved to " << filename << "\n";
+    return 0;
+}
@@ -0,0 +1,136 @@
+#include "MiniGoMT.h"
+#include "MoveRules.h"
+#include "BitUtil.h"
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+// MoveRules の規則を完全解析と突き合わせる
+// - 証明済みの規則: 規則なし / あり で初手マップと乱択局面の勝敗が一致するか、探索量がどれだけ減るか
+// - 経験則: 規則なしで解いたマップと、規則の予言が一致するか
+
+// 各連に呼吸点がある乱択局面 (手番側 my)
+static void random_position(std::mt19937_64& rng, int n, uint64_t& my, uint64_t& op) {
+    uint64_t full = (n >= 64) ? ~0ULL : ((1ULL << n) - 1);
+    while (true) {
+        my = op = 0;
+        for (int i = 0; i < n; ++i) {
+            int r = (int)(rng() % 3);
+            if (r == 1) my |= 1ULL << i;
+            else if (r == 2) op |= 1ULL << i;
+        }
+        uint64_t empty = ~(my | op) & full;
+        // 取れる連がない (呼吸点0の連もない) ことを確かめる
+        bool ok = true;
+        for (uint64_t s : {my, op}) {
+            for (uint64_t b = s; b && ok; ) {
+                int idx = bitutil::lsb_index(b);
+                uint64_t g = bitutil::group_mask(s, idx);
+                if (!bitutil::group_has_liberty(s, empty, idx)) ok = false;
+                b &= ~g;
+            }
+        }
+        if (ok && empty) return;
+    }
+}
+
+int main() {
+    int from, to, m, samples;
+    std::cout << "1xN MiniGo rule check (MoveRules vs exact search)\n";
+    std::cout << "CPU Cores: " << std::thread::hardware_concurrency() << "\n";
+    std::cout << "From: "; std::cin >> from;
+    std::cout << "To: "; std::cin >> to;
+    std::cout << "m (capture target): "; std::cin >> m;
+    std::cout << "Random positions per N (e.g. 200): "; std::cin >> samples;
+
+    for (int i = 0; i < moverules::RULE_COUNT; ++i) {
+        const moverules::RuleInfo& r = moverules::RULES[i];
+        std::cout << "  " << r.name << (r.proven ? " [proven] " : " [empirical] ") << r.statement << "\n";
+    }
+
+    MiniGoMT solver(24);
+    std::mt19937_64 rng(2024);
+
+    std::string m_suffix = (m > 1) ? "_m" + std::to_string(m) : "";
+    std::string filename = "rules_check_" + std::to_string(from) + "-" + std::to_string(to) + m_suffix + ".csv";
+    std::ofstream ofs(filename);
+    ofs << "N,Result,SameMap,NodesNone,NodesProven,SecNone,SecProven,RandomChecked,RandomMismatch";
+    for (int i = 0; i < moverules::RULE_COUNT; ++i) {
+        if (!moverules::RULES[i].proven) ofs << "," << moverules::RULES[i].name;
+    }
+    ofs << "\n";
+
+    bool all_ok = true;
+    for (int n = from; n <= to; ++n) {
+        // 1. 初手マップ: 規則なし / 証明済みの規則あり
+        std::string maps[2];
+        uint64_t nodes[2];
+        double secs[2];
+        const unsigned sets[2] = { moverules::NONE, moverules::PROVEN };
+        for (int k = 0; k < 2; ++k) {
+            solver.set_rules(sets[k]);
+            auto start = std::chrono::high_resolution_clock::now();
+            maps[k] = solver.analyze_parallel(n, m);
+            auto end = std::chrono::high_resolution_clock::now();
+            secs[k] = std::chrono::duration<double>(end - start).count();
+            nodes[k] = solver.get_progress().nodes;
+        }
+        bool same = (maps[0] == maps[1]);
+
+        // 2. 乱択局面の勝敗 (取った数も 0..m-1 で散らす)。set_rules はTTを消すので規則ごとにまとめて解く
+        struct Sample {
+            uint64_t my, op;
+            int my_cap, op_cap;
+            int res[2];
+        };
+        std::vector<Sample> pos(samples);
+        for (auto& p : pos) {
+            random_position(rng, n, p.my, p.op);
+            p.my_cap = (int)(rng() % m);
+            p.op_cap = (int)(rng() % m);
+        }
+        solver.set_board_size(n);
+        for (int k = 0; k < 2; ++k) {
+            solver.set_rules(sets[k]);
+            for (auto& p : pos) p.res[k] = solver.solve_position(p.my, p.op, p.my_cap, p.op_cap);
+        }
+        int mismatch = 0;
+        for (const auto& p : pos) {
+            if (p.res[0] != p.res[1]) ++mismatch;
+        }
+
+        // 3. 経験則の予言と規則なしのマップ
+        std::string empirical;
+        bool empirical_ok = true;
+        for (int i = 0; i < moverules::RULE_COUNT; ++i) {
+            const moverules::RuleInfo& r = moverules::RULES[i];
+            if (r.proven) continue;
+            int predicted = 0, wrong = 0;
+            for (int idx = 0; idx < n; ++idx) {
+                char mark = moverules::root_mark(r.rule, n, m, idx);
+                if (!mark) continue;
+                ++predicted;
+                if (mark != maps[0][idx]) ++wrong;
+            }
+            const char* verdict = (predicted == 0) ? "-" : (wrong == 0 ? "ok" : "fail");
+            if (wrong) empirical_ok = false;
+            empirical += std::string(",") + verdict;
+        }
+
+        bool ok = same && mismatch == 0;
+        all_ok = all_ok && ok;
+        std::cout << "N=" << n << " : [" << maps[0] << "] " << (ok ? "OK" : "MISMATCH")
+                  << " nodes " << nodes[0] << " -> " << nodes[1] << " (" << secs[0] << "s -> " << secs[1] << "s)"
+                  << " random " << samples - mismatch << "/" << samples
+                  << (empirical_ok ? "" : " (empirical rule failed)") << "\n";
+        ofs << n << "," << maps[0] << "," << (same ? 1 : 0) << "," << nodes[0] << "," << nodes[1] << ","
+            << secs[0] << "," << secs[1] << "," << samples << "," << mismatch << empirical << "\n";
+    }
+
+    std::cout << (all_ok ? "All proven rules agree with the exact search." : "Proven rules DISAGREE, see above.")
+              << "\nSaved to " << filename << "\n";
+    return all_ok ? 0 : 1;
+}
@@ -0,0 +1,16 @@
+#include "HintServer.h"
+#include <iostream>
+#include <string>
+
+// 使い方: ./hint_server [socket_path] [tt_bits]
+// 例: ./hint_server /tmp/minigo_hint.sock 22
+int main(int argc, char** argv) {
+    std::string path = (argc > 1) ? argv[1] : "/tmp/minigo_hint.sock";
+
+    // N ごとに 2^tt_bits エントリのTTを確保する (22 = 64MB)
+    int tt_bits = (argc > 2) ? std::stoi(argv[2]) : 22;
+
+    std::cout << "1xN MiniGo Hint Server (Bitboard + Cache)\n";
+    HintServer server(path, tt_bits);
+    return server.run();
+}
@@ -0,0 +1,106 @@
+#include "SumGame.h"
+#include <iostream>
+#include <sstream>
+#include <chrono>
+
+// 入力例: 0,0,0,0,0 0,0,0,0,0,0 0,1,0,-1,0
+// (1行に成分を空白区切りで並べる。0:空, 1:黒, -1:白)
+static bool parse_rows(const std::string& line, std::vector<RowPosition>& rows) {
+    std::stringstream ss(line);
+    std::string token;
+    while (ss >> token) {
+        RowPosition row;
+        std::stringstream cs(token);
+        std::string cell;
+        while (std::getline(cs, cell, ',')) {
+            if (cell == "1") row.black |= 1ULL << row.n;
+            else if (cell == "-1") row.white |= 1ULL << row.n;
+            else if (cell != "0") return false;
+            row.n++;
+        }
+        if (row.n == 0 || row.n > ValueSolver::MAX_N) return false;
+        rows.push_back(row);
+    }
+    return !rows.empty();
+}
+
+// 空の列 2 つ (長さ 1..10 の 55 通り) で、値の足し算の帰結類を README の規則の総当たりと比べる
+// 食い違った数を返す
+static int check_empty_pairs() {
+    int mismatches = 0;
+    for (int a = 1; a <= 10; ++a) {
+        for (int b = a; b <= 10; ++b) {
+            std::vector<RowPosition> rows(2);
+            rows[0].n = a;
+            rows[1].n = b;
+            CGTEngine engine;
+            SumGame game(engine);
+            std::string outcome = game.outcome_class(rows);
+            SumSearch search(true);
+            char brute = search.outcome_class(rows);
+            if (outcome[0] != brute) {
+                std::cout << "  MISMATCH " << a << "+" << b << ": value [" << outcome << "] brute force [" << brute << "]\n";
+                ++mismatches;
+            }
+        }
+    }
+    return mismatches;
+}
+
+int main() {
+    std::cout << "1xN MiniGo Sum Game (Direct Sum of Rows)\n";
+
+    std::cout << "Rows (e.g. 0,0,0,0,0 0,0,0,0,0,0), or \"check\" to test all pairs of empty rows: ";
+    std::string line;
+    std::getline(std::cin, line);
+
+    // 総当たりの側が重い (十数秒) ので、頼まれたときだけ
+    if (line == "check") {
+        int mismatches = check_empty_pairs();
+        std::cout << "Self-check (55 pairs of empty rows, lengths 1..10): "
+                  << (mismatches == 0 ? "OK" : std::to_string(mismatches) + " mismatches") << "\n";
+        return mismatches == 0 ? 0 : 1;
+    }
+
+    std::vector<RowPosition> rows;
+    if (!parse_rows(line, rows)) {
+        std::cout << "Invalid input.\n";
+        return 1;
+    }
+
+    // 値の足し算による解析
+    auto start = std::chrono::high_resolution_clock::now();
+    CGTEngine engine;
+    SumGame game(engine);
+    GameId total = game.total_value(rows);
+    std::string outcome = game.outcome_class(rows);
+    SumGame::Move black_move = game.best_move(rows, true);
+    SumGame::Move white_move = game.best_move(rows, false);
+    auto mid = std::chrono::high_resolution_clock::now();
+
+    // README の規則 (どこかで1つ取ったらゲーム全体の勝ち) での積空間の総当たり (比較用)
+    SumSearch search(true);
+    char brute = search.outcome_class(rows);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    double value_sec = std::chrono::duration<double>(mid - start).count();
+    double brute_sec = std::chrono::duration<double>(end - mid).count();
+
+    for (size_t r = 0; r < rows.size(); ++r) {
+        std::cout << "  row " << r << " : " << engine.to_string(game.component_value(rows[r])) << "\n";
+    }
+    std::cout << "(A capture is valued at +-" << game.get_capture_value() << ", more than the moves left)\n";
+    std::cout << "Sum value : " << engine.to_string(total) << " [" << outcome << "]\n";
+    std::cout << "Black best: row " << black_move.row << " pos " << black_move.pos
+              << (black_move.winning ? " (win)" : " (lose)") << "\n";
+    std::cout << "White best: row " << white_move.row << " pos " << white_move.pos
+              << (white_move.winning ? " (win)" : " (lose)") << "\n";
+    std::cout << "Value arithmetic: " << value_sec << "s\n";
+    std::cout << "Brute force     : [" << brute << "] " << brute_sec << "s ("
+              << search.get_node_count() << " nodes)\n";
+    if (outcome[0] != brute) {
+        std::cout << "MISMATCH!\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,70 @@
+#include "ValueSolver.h"
+#include "Thermograph.h"
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <algorithm>
+#include <tuple>
+
+int main() {
+    int n;
+    std::cout << "1xN MiniGo Thermograph (Temperature Analysis)\n";
+    std::cout << "Board size N: "; std::cin >> n;
+    if (n < 1 || n > ValueSolver::MAX_N) {
+        std::cout << "N must be 1.." << ValueSolver::MAX_N << "\n";
+        return 1;
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    CGTEngine engine;
+    ValueSolver solver(engine);
+    ThermoAnalyzer thermo(engine);
+
+    solver.set_board_size(n);
+    GameId root = solver.value(0, 0);
+
+    // 空盤から到達できる全局面 (手番を問わない) を盤面順に並べる
+    std::vector<std::tuple<uint64_t, uint64_t, GameId>> positions;
+    solver.for_each_position([&](uint64_t black, uint64_t white, GameId g) {
+        positions.emplace_back(black, white, g);
+    });
+    std::sort(positions.begin(), positions.end());
+
+    std::string filename = "thermo_1x" + std::to_string(n) + ".csv";
+    std::ofstream ofs(filename);
+    ofs << "RawBoard,Value,Outcome,LeftStop,RightStop,Mean,Temperature,LeftWall,RightWall\n";
+
+    double max_temp = -1;
+    for (const auto& [black, white, g] : positions) {
+        std::string raw_board = "";
+        for (int i = 0; i < n; ++i) {
+            if (i) raw_board += ",";
+            if ((black >> i) & 1) raw_board += "1";
+            else if ((white >> i) & 1) raw_board += "-1";
+            else raw_board += "0";
+        }
+
+        const Thermograph& th = thermo.thermograph(g);
+        max_temp = std::max(max_temp, th.temperature);
+
+        ofs << "\"" << raw_board << "\",\"" << engine.to_string(g) << "\","
+            << engine.outcome_class(g) << ","
+            << th.left_stop << "," << th.right_stop << ","
+            << th.mean << "," << th.temperature << ",";
+        // 数でない局面だけ温度図の壁を出す
+        if (engine.is_number(g)) ofs << ",\n";
+        else ofs << th.left_wall.to_string() << "," << th.right_wall.to_string() << "\n";
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    double sec = std::chrono::duration<double>(end - start).count();
+
+    const Thermograph& root_th = thermo.thermograph(root);
+    std::cout << "N=" << n << " : mean=" << root_th.mean << " temperature=" << root_th.temperature
+              << " stops=(" << root_th.left_stop << "," << root_th.right_stop << ")\n";
+    std::cout << "Positions: " << positions.size() << ", distinct values: " << thermo.cache_size()
+              << ", max temperature: " << max_temp << " (" << sec << "s)\n";
+    std::cout << "Done. Saved to " << filename << "\n";
+    return 0;
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// 数え上げ用の最小限の多倍長整数 (非負、足し算と 2 での割り算だけ)
+// 10^9 進で下の桁から持つので、10 進の文字列へはそのまま書き出せる
+struct BigUInt {
+    static const uint32_t BASE = 1000000000u;
+    std::vector<uint32_t> limbs; // 空なら 0
+
+    BigUInt() {}
+    BigUInt(uint64_t v) {
+        while (v) {
+            limbs.push_back((uint32_t)(v % BASE));
+            v /= BASE;
+        }
+    }
+
+    bool is_zero() const { return limbs.empty(); }
+
+    BigUInt& operator+=(const BigUInt& o) {
+        if (o.limbs.size() > limbs.size()) limbs.resize(o.limbs.size(), 0);
+        uint32_t carry = 0;
+        for (size_t i = 0; i < limbs.size(); ++i) {
+            uint32_t sum = limbs[i] + carry + (i < o.limbs.size() ? o.limbs[i] : 0);
+            carry = (sum >= BASE) ? 1 : 0;
+            limbs[i] = sum - (carry ? BASE : 0);
+            if (!carry && i >= o.limbs.size()) break;
+        }
+        if (carry) limbs.push_back(carry);
+        return *this;
+    }
+
+    friend BigUInt operator+(BigUInt a, const BigUInt& b) { return a += b; }
+
+    // 2 で割る (割り切れる前提で使う。余りは捨てる)
+    BigUInt half() const {
+        BigUInt r;
+        r.limbs.resize(limbs.size());
+        uint64_t rem = 0;
+        for (size_t i = limbs.size(); i-- > 0;) {
+            uint64_t cur = limbs[i] + rem * BASE;
+            r.limbs[i] = (uint32_t)(cur / 2);
+            rem = cur % 2;
+        }
+        while (!r.limbs.empty() && r.limbs.back() == 0) r.limbs.pop_back();
+        return r;
+    }
+
+    bool operator==(const BigUInt& o) const { return limbs == o.limbs; }
+    bool operator!=(const BigUInt& o) const { return limbs != o.limbs; }
+
+    std::string to_string() const {
+        if (limbs.empty()) return "0";
+        std::string s = std::to_string(limbs.back());
+        for (size_t i = limbs.size() - 1; i-- > 0;) {
+            std::string part = std::to_string(limbs[i]);
+            s += std::string(9 - part.size(), '0') + part;
+        }
+        return s;
+    }
+};
@@ -0,0 +1,245 @@
+#include "GameDAG.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace {
+
+const uint64_t EMPTY_SLOT = ~0ULL; // 黒と白が重なるので局面のキーにはならない
+
+// 層を作るときの重複除去用。開番地法で、空きスロットに CAS で書き込む
+class ConcurrentKeySet {
+public:
+    explicit ConcurrentKeySet(size_t expected) {
+        size_t cap = 1024;
+        while (cap < expected * 2) cap <<= 1;
+        slots.reset(new std::atomic<uint64_t>[cap]);
+        for (size_t i = 0; i < cap; ++i) slots[i].store(EMPTY_SLOT, std::memory_order_relaxed);
+        mask = cap - 1;
+    }
+
+    void insert(uint64_t key) {
+        for (size_t i = hash(key) & mask;; i = (i + 1) & mask) {
+            uint64_t cur = slots[i].load(std::memory_order_relaxed);
+            if (cur == key) return;
+            if (cur == EMPTY_SLOT) {
+                if (slots[i].compare_exchange_strong(cur, key, std::memory_order_relaxed)) return;
+                if (cur == key) return; // 同じキーを別スレッドが先に書いた
+            }
+        }
+    }
+
+    size_t capacity() const { return mask + 1; }
+    uint64_t at(size_t i) const { return slots[i].load(std::memory_order_relaxed); }
+
+private:
+    std::unique_ptr<std::atomic<uint64_t>[]> slots;
+    size_t mask;
+
+    static uint64_t hash(uint64_t x) {
+        x ^= x >> 33;
+        x *= 0xFF51AFD7ED558CCDULL;
+        x ^= x >> 33;
+        return x;
+    }
+};
+
+// 一番下の立っているビットの位置 (b != 0)
+inline int bit_scan_forward(uint32_t b) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, b);
+    return (int)index;
+#else
+    return __builtin_ctz(b);
+#endif
+}
+
+inline uint32_t reverse_n(uint32_t x, int n) {
+    uint32_t r = 0;
+    for (int i = 0; i < n; ++i) r |= ((x >> i) & 1) << (n - 1 - i);
+    return r;
+}
+
+// idx を含む stones の連が呼吸点を持つか
+inline bool has_liberty(uint32_t stones, uint32_t empty, int idx, int n) {
+    int l = idx, r = idx;
+    while (l > 0 && ((stones >> (l - 1)) & 1)) --l;
+    while (r < n - 1 && ((stones >> (r + 1)) & 1)) ++r;
+    return (l > 0 && ((empty >> (l - 1)) & 1)) || (r < n - 1 && ((empty >> (r + 1)) & 1));
+}
+
+} // namespace
+
+GameDAG::GameDAG(int threads_) : threads(threads_) {
+    if (threads <= 0) threads = std::max(1u, std::thread::hardware_concurrency());
+}
+
+template <class F>
+void GameDAG::parallel_for(size_t count, F f) const {
+    int t = (int)std::min<size_t>(threads, std::max<size_t>(1, count / 256));
+    if (t <= 1) {
+        f(0, count, 0);
+        return;
+    }
+    std::vector<std::thread> pool;
+    size_t step = (count + t - 1) / t;
+    for (int i = 1; i < t; ++i) {
+        size_t b = std::min(count, step * i), e = std::min(count, step * (i + 1));
+        pool.emplace_back([=, &f]() { f(b, e, i); });
+    }
+    f(0, std::min(count, step), 0);
+    for (auto& th : pool) th.join();
+}
+
+uint64_t GameDAG::canonical(uint64_t key) const {
+    uint64_t rev = (uint64_t)reverse_n((uint32_t)key, n_size) |
+                   ((uint64_t)reverse_n((uint32_t)(key >> 32), n_size) << 32);
+    return std::min(key, rev);
+}
+
+int GameDAG::play(uint64_t key, bool black_to_move, int idx, uint64_t& child) const {
+    uint32_t black = (uint32_t)key, white = (uint32_t)(key >> 32);
+    uint32_t mover = black_to_move ? black : white;
+    uint32_t other = black_to_move ? white : black;
+    uint32_t bit = 1u << idx;
+    mover |= bit;
+    uint32_t empty = ~(mover | other) & full_mask;
+
+    // 隣の相手の連を取れるなら終局
+    if (idx > 0 && ((other >> (idx - 1)) & 1) && !has_liberty(other, empty, idx - 1, n_size)) return 2;
+    if (idx < n_size - 1 && ((other >> (idx + 1)) & 1) && !has_liberty(other, empty, idx + 1, n_size)) return 2;
+    if (!has_liberty(mover, empty, idx, n_size)) return 0;
+
+    uint64_t b = black_to_move ? mover : black;
+    uint64_t w = black_to_move ? white : mover;
+    child = canonical(b | (w << 32));
+    return 1;
+}
+
+int64_t GameDAG::find(uint64_t key, int layer) const {
+    auto first = keys.begin() + layer_start[layer];
+    auto last = keys.begin() + layer_start[layer + 1];
+    auto it = std::lower_bound(first, last, key);
+    return (it != last && *it == key) ? (int64_t)(it - keys.begin()) : -1;
+}
+
+void GameDAG::build(int n) {
+    n_size = std::max(1, std::min(n, MAX_N));
+    full_mask = (n_size >= 32) ? ~0u : ((1u << n_size) - 1);
+    keys.assign(1, 0); // 層 0 は空の盤面だけ
+    layer_start.assign({0, 1});
+    row_start.assign(1, 0);
+    children.clear();
+    has_capture.clear();
+
+    for (int layer = 0;; ++layer) {
+        const size_t begin = layer_start[layer], end = layer_start[layer + 1];
+        const size_t count = end - begin;
+        const bool black_to_move = (layer % 2 == 0);
+
+        // 1. 子の数を数える (取る手は辺にしない)
+        std::vector<uint32_t> degree(count);
+        std::vector<uint8_t> capture(count);
+        parallel_for(count, [&](size_t b, size_t e, int) {
+            for (size_t i = b; i < e; ++i) {
+                uint64_t key = keys[begin + i];
+                uint32_t empty = ~((uint32_t)key | (uint32_t)(key >> 32)) & full_mask;
+                for (uint32_t em = empty; em; em &= em - 1) {
+                    uint64_t child;
+                    int r = play(key, black_to_move, bit_scan_forward(em), child);
+                    if (r == 1) ++degree[i];
+                    else if (r == 2) capture[i] = 1;
+                }
+            }
+        });
+        has_capture.insert(has_capture.end(), capture.begin(), capture.end());
+
+        size_t edge_base = children.size();
+        size_t total = 0;
+        for (size_t i = 0; i < count; ++i) {
+            total += degree[i];
+            row_start.push_back(edge_base + total);
+        }
+        if (total == 0) break; // 次の層は空
+
+        // 2. 子のキーを辺の場所に書き、次の層の集合に入れる
+        std::vector<uint64_t> edge_keys(total);
+        ConcurrentKeySet next_set(total);
+        parallel_for(count, [&](size_t b, size_t e, int) {
+            for (size_t i = b; i < e; ++i) {
+                uint64_t key = keys[begin + i];
+                uint32_t empty = ~((uint32_t)key | (uint32_t)(key >> 32)) & full_mask;
+                size_t pos = row_start[begin + i] - edge_base;
+                for (uint32_t em = empty; em; em &= em - 1) {
+                    uint64_t child;
+                    if (play(key, black_to_move, bit_scan_forward(em), child) != 1) continue;
+                    edge_keys[pos++] = child;
+                    next_set.insert(child);
+                }
+            }
+        });
+
+        // 3. 次の層をキー順に並べる (番号を決定的にする)
+        std::vector<std::vector<uint64_t>> parts(threads);
+        parallel_for(next_set.capacity(), [&](size_t b, size_t e, int t) {
+            for (size_t i = b; i < e; ++i) {
+                uint64_t k = next_set.at(i);
+                if (k != EMPTY_SLOT) parts[t].push_back(k);
+            }
+        });
+        size_t next_begin = keys.size();
+        for (auto& p : parts) keys.insert(keys.end(), p.begin(), p.end());
+        std::sort(keys.begin() + next_begin, keys.end());
+        layer_start.push_back((uint32_t)keys.size());
+
+        // 4. 辺のキーを局面番号にする
+        children.resize(edge_base + total);
+        parallel_for(total, [&](size_t b, size_t e, int) {
+            for (size_t i = b; i < e; ++i) children[edge_base + i] = (uint32_t)find(edge_keys[i], layer + 1);
+        });
+    }
+}
+
+void GameDAG::solve() {
+    result.assign(keys.size(), 0);
+    for (int layer = (int)num_layers() - 1; layer >= 0; --layer) {
+        size_t begin = layer_start[layer];
+        parallel_for(layer_start[layer + 1] - begin, [&](size_t b, size_t e, int) {
+            for (size_t i = begin + b; i < begin + e; ++i) {
+                bool win = has_capture[i];
+                for (uint64_t k = row_start[i]; !win && k < row_start[i + 1]; ++k) {
+                    if (result[children[k]] < 0) win = true;
+                }
+                // 子が無く取る手も無ければ合法手なしで負け
+                result[i] = win ? 1 : -1;
+            }
+        });
+    }
+}
+
+int GameDAG::root_winner() const {
+    return (result.empty() || result[0] > 0) ? 1 : -1;
+}
+
+std::string GameDAG::first_move_map() const {
+    std::string map(n_size, 'x');
+    for (int i = 0; i < n_size; ++i) {
+        uint64_t child;
+        int r = play(0, true, i, child);
+        if (r == 2) map[i] = 'g';
+        else if (r == 1) map[i] = (result[find(child, 1)] < 0) ? 'g' : 'r';
+    }
+    return map;
+}
+
+size_t GameDAG::num_capture_nodes() const {
+    size_t c = 0;
+    for (uint8_t f : has_capture) c += f;
+    return c;
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Solver と同じゲーム (m=1: 取ったら勝ち) の局面グラフを、石の数ごとの層に分けて並列に作る
+//
+// 1手ごとに石が1つ増え、取ったらそこで終局なので、続いている局面は 石の数 = 層 の DAG になる。
+// 層 L の局面を並列に展開して層 L+1 を作り (重複は CAS のハッシュ集合で除く)、辺は CSR で持つ。
+// 勝敗は最後の層から逆順に、層の中を並列に決める
+//
+// 局面は左右反転を同一視し、黒白のビットボードを1つの 64bit キーにする (N <= 32)。
+// 手番は石の数から決まる (偶数なら黒番)。取る手は辺にせず、has_capture で持つ
+class GameDAG {
+public:
+    static const int MAX_N = 32;
+
+    // threads = 0 ならコア数
+    explicit GameDAG(int threads = 0);
+
+    // 空の 1xn から到達できる (終局していない) 局面を全部作る
+    void build(int n);
+
+    // 最後の層から勝敗を決める
+    void solve();
+
+    // 初期局面の勝者 (1: 黒, -1: 白)
+    int root_winner() const;
+
+    // 初手マップ ('g'=勝ち 'r'=負け 'x'=自殺手)。Solver / MiniGoMT の結果と同じ形式
+    std::string first_move_map() const;
+
+    size_t num_nodes() const { return keys.size(); }
+    size_t num_edges() const { return children.size(); }
+    size_t num_layers() const { return layer_start.empty() ? 0 : layer_start.size() - 1; }
+    size_t num_capture_nodes() const;
+    int thread_count() const { return threads; }
+
+private:
+    int threads;
+    int n_size = 0;
+    uint32_t full_mask = 0;
+
+    // 局面 i のキー (下位 32bit が黒、上位 32bit が白)。層ごとに並べ、層の中はキー順
+    std::vector<uint64_t> keys;
+    // 層 L の局面は [layer_start[L], layer_start[L+1])
+    std::vector<uint32_t> layer_start;
+    // CSR: 局面 i の子は children[row_start[i] .. row_start[i+1])
+    std::vector<uint64_t> row_start;
+    std::vector<uint32_t> children;
+    // 取る手 (=その場で勝ち) があるか
+    std::vector<uint8_t> has_capture;
+    // 手番側から見た勝敗 1=勝ち, -1=負け (solve の後)
+    std::vector<int8_t> result;
+
+    uint64_t canonical(uint64_t key) const;
+
+    // key の局面 (手番 black_to_move) で idx に打つ。0=自殺手, 1=通常, 2=取る。通常なら child に子のキー
+    int play(uint64_t key, bool black_to_move, int idx, uint64_t& child) const;
+
+    // 層の中の局面を探す (見つからなければ -1)
+    int64_t find(uint64_t key, int layer) const;
+
+    // [0, count) をスレッドに分けて f(begin, end, thread) を呼ぶ
+    template <class F>
+    void parallel_for(size_t count, F f) const;
+};
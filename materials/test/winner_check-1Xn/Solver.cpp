@@ -109,41 +109,72 @@ void Solver::_setup_terminal_node(GameNode* node, int winner, const std::string&
 
 
 // (ヘルパー3) 探索と評価
+// 勝ちになる子が1つ見つかればノードの勝敗は決まるので、残りの子は解かずに unexplored に積む
+// (children には全部の手を登録しておく。残りはヒント盤面が必要になったとき expand_all で解く)
 void Solver::_explore_children_and_evaluate(GameNode* node_ptr,
                                             const MiniGo1xN& game,
                                             const std::vector<int>& moves) {
     std::vector<GameNode*> child_nodes;
 
-    for (int m : moves) {
-        auto [next_game, captured] = game.make_move(m);
-
-        // 表示用ID
-        HashKey child_hash = compute_hash(next_game.board, next_game.player);
-        node_ptr->children[child_hash] = m;  // move string ではなく int でOK
-
-
-        GameNode* child_node = nullptr;
+    for (size_t i = 0; i < moves.size(); ++i) {
+        int m = moves[i];
+        GameNode* child_node = _solve_child(game, m);
+        node_ptr->children[compute_hash(child_node->board_state, child_node->player_to_move)] = m;
+        child_nodes.push_back(child_node);
 
-        if (captured) {
-            // 捕獲 = 終局ノード
-            HashKey ckey = compute_hash(next_game.board, next_game.player);
-            if (!nodes.count(ckey)) {
-                child_node = _create_new_node(ckey, next_game);
-                _setup_terminal_node(child_node, game.player, "Lost (Captured)");
-            } else {
-                child_node = nodes.at(ckey).get();
+        if (child_node->winner == game.player) {
+            for (size_t j = i + 1; j < moves.size(); ++j) {
+                int rest = moves[j];
+                auto [next_game, captured] = game.make_move(rest);
+                (void)captured;
+                node_ptr->children[compute_hash(next_game.board, next_game.player)] = rest;
+                node_ptr->unexplored.push_back(rest);
             }
-        } else {
-            // 再帰
-            child_node = _find_value(next_game);
+            if (!node_ptr->unexplored.empty()) lazy_nodes.push_back(node_ptr);
+            break;
         }
-        child_nodes.push_back(child_node);
     }
 
     search_winner_Minimax(node_ptr, child_nodes, game.player);
 }
 
 
+GameNode* Solver::_solve_child(const MiniGo1xN& game, int m) {
+    auto [next_game, captured] = game.make_move(m);
+    if (!captured) {
+        // 再帰
+        return _find_value(next_game);
+    }
+
+    // 捕獲 = 終局ノード
+    HashKey ckey = compute_hash(next_game.board, next_game.player);
+    auto it = nodes.find(ckey);
+    if (it != nodes.end()) return it->second.get();
+    GameNode* child_node = _create_new_node(ckey, next_game);
+    _setup_terminal_node(child_node, game.player, "Lost (Captured)");
+    return child_node;
+}
+
+
+void Solver::_expand_node(GameNode* node_ptr) {
+    if (node_ptr->unexplored.empty()) return;
+    MiniGo1xN game(node_ptr->board_state, node_ptr->player_to_move);
+    std::vector<int> moves;
+    moves.swap(node_ptr->unexplored);
+    for (int m : moves) _solve_child(game, m);
+}
+
+
+void Solver::expand_all() {
+    // 子を解くと新しく打ち切ったノードが lazy_nodes に増えるので、空になるまで続ける
+    while (!lazy_nodes.empty()) {
+        GameNode* node_ptr = lazy_nodes.back();
+        lazy_nodes.pop_back();
+        _expand_node(node_ptr);
+    }
+}
+
+
 // (ヘルパー4)勝敗判定 (Minimax法) すべての子ノードの結果を見て現在のノードの勝敗を決定する
 void Solver::search_winner_Minimax(GameNode* node_ptr, const std::vector<GameNode*>& child_nodes, int current_player){ 
     bool found_win = false;
@@ -190,7 +221,8 @@ GameNode* Solver::_find_value(const MiniGo1xN& game) {
 }
 
 
-void Solver::print_all_nodes() const {
+void Solver::print_all_nodes() {
+    expand_all();
     for (const auto& [key, node] : nodes) { //nodesがsolver.hで定義済み
         std::cout << "Node key: " << key << "\n  Board: ";
         for (int v : node->board_state) std::cout << v << " ";
@@ -222,7 +254,8 @@ int Solver::get_initial_winner(const std::vector<int>& board, int player) const
 
 
 
-void Solver::print_minimax_summary() const {
+void Solver::print_minimax_summary() {
+    expand_all();
     std::cout << "---  Minimax Summary ---" << "\n";
     std::cout << "(Key: [Player] -> Winner: W, Optimal: O, Children: [...])\n\n";
 
@@ -250,11 +283,15 @@ void Solver::print_minimax_summary() const {
 
 void Solver::export_heatmap_csv(
     const std::vector<int>& board, int player,
-    const std::string& filename) const
+    const std::string& filename)
 {
     MiniGo1xN game(board, player);
     auto moves = game.get_legal_moves();
 
+    // 打ち切った子があればここで解く
+    auto root = nodes.find(compute_hash(board, player));
+    if (root != nodes.end()) _expand_node(root->second.get());
+
     std::ofstream ofs(filename);
     ofs << "move,color,result\n";
 
@@ -284,7 +321,11 @@ void Solver::export_heatmap_csv(
 // ★修正版: 盤面データをダブルクォートで囲んで出力する
 // Solver.cpp の末尾にある export_all_nodes_csv をこれに置き換え
 
-void Solver::export_all_nodes_csv(const std::string& filename) const {
+void Solver::export_all_nodes_csv(const std::string& filename) {
+    // 全ノードのヒント盤面を作るので、打ち切った子も全部解いておく
+    // (ループ中に nodes へ追加すると反復子が無効になるので先に済ませる)
+    expand_all();
+
     std::ofstream file(filename);
     // Header: 
     // RawBoard: 検索用キー (例: "0,0,1")
@@ -19,6 +19,7 @@ struct GameNode {
     std::string outcome_class;          // 勝敗分類
     bool is_optimal;                    // 最善手フラグ
     int winner = 0;                     // 勝利判定0=勝敗未定, 1=黒勝ち, -1=白勝ち
+    std::vector<int> unexplored;        // 勝ち手が見つかって探索を打ち切った残りの手 (子はまだ解いていない)
 
     GameNode(const std::vector<int>& board, int player)
         : board_state(board), player_to_move(player), game_value(""), outcome_class(""), is_optimal(false) {}
@@ -36,13 +37,14 @@ public:
 
 
     // メモ化マップに格納されたノード数を取得
+    // (勝ちの子が見つかった所で打ち切った木の数。全部の局面を数えるなら先に expand_all を呼ぶ)
     size_t num_nodes() const { return nodes.size(); }
 
-    // デバッグ用：全ノード出力e
-    void print_all_nodes() const;
+    // デバッグ用：全ノード出力e (打ち切った子も解いてから出す)
+    void print_all_nodes();
 
-    // デバッグ用:Minimaxの要約出力
-    void print_minimax_summary() const;
+    // デバッグ用:Minimaxの要約出力 (打ち切った子も解いてから出す)
+    void print_minimax_summary();
 
     // デバック用:最善手を出力する
     void print_optinal_sort() const;
@@ -50,14 +52,21 @@ public:
     //勝者を判定する(Max,min法)
     int get_initial_winner() const;
 
-    void export_heatmap_csv(const std::vector<int>& board, int player, const std::string& filename) const;
-    
-    void export_all_nodes_csv(const std::string& filename) const;
+    // 探索を打ち切った子も解く (ヒント盤面を全部そろえる)。export_* は必要な分を自分で呼ぶ
+    void expand_all();
+
+    // 出力に必要な子がまだ解かれていなければ、その場で解く
+    void export_heatmap_csv(const std::vector<int>& board, int player, const std::string& filename);
+
+    void export_all_nodes_csv(const std::string& filename);
     
 private:
      // ★変更: string キー → Zobrist ハッシュキー
     std::unordered_map<HashKey, std::unique_ptr<GameNode>> nodes;
 
+    // unexplored が残っているノード (expand_all で解く)
+    std::vector<GameNode*> lazy_nodes;
+
 
     // ★Zobrist 用テーブル
     std::vector<std::vector<HashKey>> zobrist_table; // [pos][pieceIndex]
@@ -90,6 +99,12 @@ private:
     // (ヘルパー3) 子ノードを探索し、結果を評価する
     void _explore_children_and_evaluate(GameNode* node_ptr, const MiniGo1xN& game, const std::vector<int>& moves);
 
+    // 子局面 (m を打った後) を解いてノードを返す。取ったら終局ノード
+    GameNode* _solve_child(const MiniGo1xN& game, int m);
+
+    // node の unexplored の子を全部解く
+    void _expand_node(GameNode* node_ptr);
+
     // (ヘルパー4) 子ノードリストから親の勝敗を決定する (前回作成)
     void search_winner_Minimax(GameNode* node_ptr, const std::vector<GameNode*>& child_nodes, int current_player);
 
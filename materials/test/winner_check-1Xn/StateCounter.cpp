@@ -0,0 +1,151 @@
+#include "StateCounter.h"
+#include <algorithm>
+
+int StateCounter::next_state(int s, int cell) {
+    if (cell == 0) return EMPTY; // 直前の連には右側に呼吸点ができる
+    int lib = (cell == 1) ? BLACK_LIB : WHITE_LIB;
+    int nolib = (cell == 1) ? BLACK_NOLIB : WHITE_NOLIB;
+    int other_lib = (cell == 1) ? WHITE_LIB : BLACK_LIB;
+    switch (s) {
+    case WALL:
+        return nolib;
+    case EMPTY:
+        return lib;
+    default:
+        if (s == lib || s == nolib) return s;           // 同じ色の連が続く
+        return (s == other_lib) ? nolib : -1;           // 相手の連が閉じる。呼吸点がなければ不可
+    }
+}
+
+// 盤を左から読む表 table[s][d + to] (長さ i を読み終えた状態 s・石差 d の数) を i = 1..to と1回だけ伸ばし、
+// 各長さで 長さ i の盤 (全体) と、長さ 2i-1, 2i の左右対称な盤 (左半分が長さ i) の分を拾う
+//
+// 左右対称な盤面は左半分 (奇数なら中央を含む) で決まる。中央をまたぐ連は左右に同じだけ伸びるので、
+// 呼吸点は左側にしかありえない。つまり「半分の盤の右端を壁とみなして合法」と同じ
+std::vector<StateCounter::Counts> StateCounter::count_range(int from, int to) const {
+    from = std::max(from, 1);
+    if (to < from) return {};
+
+    // N ごとの途中の和
+    struct Partial {
+        BigUInt legal, legal_sym;
+        BigUInt balance0, balance1;         // 石差 0 / 1 の合法盤面 (黒番 / 白番)
+        BigUInt sym_balance0, sym_balance1; // 同じく左右対称なもの
+    };
+    std::vector<Partial> part(to - from + 1);
+
+    const int offset = to;
+    const int width = 2 * offset + 1;
+    std::vector<std::vector<BigUInt>> cur(NUM_STATES, std::vector<BigUInt>(width));
+    std::vector<std::vector<BigUInt>> next(NUM_STATES, std::vector<BigUInt>(width));
+    cur[WALL][offset] = BigUInt(1);
+
+    for (int i = 1; i <= to; ++i) {
+        // 石差の範囲は長さ i-1 までで [-(i-1), i-1] なので、その範囲だけ回す
+        for (auto& row : next) std::fill(row.begin() + (offset - i), row.begin() + (offset + i + 1), BigUInt());
+        for (int s = 0; s < NUM_STATES; ++s) {
+            for (int d = offset - (i - 1); d <= offset + (i - 1); ++d) {
+                if (cur[s][d].is_zero()) continue;
+                for (int cell = 0; cell < 3; ++cell) {
+                    int t = next_state(s, cell);
+                    if (t < 0) continue;
+                    int nd = d + (cell == 1 ? 1 : cell == 2 ? -1 : 0);
+                    next[t][nd] += cur[s][d];
+                }
+            }
+        }
+        std::swap(cur, next);
+
+        // 右端を盤の端として受理できる状態だけ数える
+        for (int s = 0; s < NUM_STATES; ++s) {
+            if (!accepting(s)) continue;
+            if (i >= from) {
+                Partial& p = part[i - from];
+                for (int d = offset - i; d <= offset + i; ++d) p.legal += cur[s][d];
+                p.balance0 += cur[s][offset];
+                p.balance1 += cur[s][offset + 1];
+            }
+            for (int n = 2 * i - 1; n <= 2 * i; ++n) {
+                if (n < from || n > to) continue;
+                Partial& p = part[n - from];
+                // 奇数のときの中央のマス (最後に読んだマス) は1回だけ数える
+                int mid = 0;
+                if (n % 2 == 1) {
+                    if (s == BLACK_LIB || s == BLACK_NOLIB) mid = 1;
+                    else if (s == WHITE_LIB || s == WHITE_NOLIB) mid = -1;
+                }
+                for (int d = offset - i; d <= offset + i; ++d) {
+                    if (cur[s][d].is_zero()) continue;
+                    p.legal_sym += cur[s][d];
+                    int full = 2 * (d - offset) - mid;
+                    if (full == 0) p.sym_balance0 += cur[s][d];
+                    else if (full == 1) p.sym_balance1 += cur[s][d];
+                }
+            }
+        }
+    }
+
+    std::vector<Counts> result(to - from + 1);
+    for (size_t k = 0; k < result.size(); ++k) {
+        const Partial& p = part[k];
+        Counts& c = result[k];
+        c.legal = p.legal;
+        c.legal_canonical = (p.legal + p.legal_sym).half();
+        c.black_to_move = p.balance0;
+        c.white_to_move = p.balance1;
+        c.reachable = p.balance0 + p.balance1;
+        c.reachable_canonical = (c.reachable + p.sym_balance0 + p.sym_balance1).half();
+    }
+    return result;
+}
+
+StateCounter::Counts StateCounter::count(int n) const {
+    return count_range(n, n)[0];
+}
+
+StateCounter::Counts StateCounter::brute_force(int n) {
+    uint64_t legal = 0, legal_canon = 0, black = 0, white = 0, reach_canon = 0;
+    std::vector<int> cells(n, 0), mirrored(n);
+    uint64_t total = 1;
+    for (int i = 0; i < n; ++i) total *= 3;
+
+    for (uint64_t code = 0; code < total; ++code) {
+        uint64_t x = code;
+        int balance = 0;
+        for (int i = 0; i < n; ++i) {
+            cells[i] = (int)(x % 3);
+            x /= 3;
+            balance += (cells[i] == 1) ? 1 : (cells[i] == 2) ? -1 : 0;
+        }
+        // どの連にも呼吸点があるか
+        bool ok = true;
+        for (int i = 0; i < n && ok;) {
+            if (cells[i] == 0) { ++i; continue; }
+            int j = i;
+            while (j + 1 < n && cells[j + 1] == cells[i]) ++j;
+            bool lib = (i > 0 && cells[i - 1] == 0) || (j + 1 < n && cells[j + 1] == 0);
+            ok = lib;
+            i = j + 1;
+        }
+        if (!ok) continue;
+
+        // 反転した盤と比べて小さい方 (同じなら自身) だけを代表にする
+        for (int i = 0; i < n; ++i) mirrored[i] = cells[n - 1 - i];
+        bool canonical = !std::lexicographical_compare(mirrored.begin(), mirrored.end(), cells.begin(), cells.end());
+        ++legal;
+        if (canonical) ++legal_canon;
+        if (balance == 0 || balance == 1) {
+            (balance == 0 ? black : white)++;
+            if (canonical) ++reach_canon;
+        }
+    }
+
+    Counts c;
+    c.legal = BigUInt(legal);
+    c.legal_canonical = BigUInt(legal_canon);
+    c.black_to_move = BigUInt(black);
+    c.white_to_move = BigUInt(white);
+    c.reachable = BigUInt(black + white);
+    c.reachable_canonical = BigUInt(reach_canon);
+    return c;
+}
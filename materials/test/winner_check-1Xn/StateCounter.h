@@ -0,0 +1,39 @@
+#pragma once
+#include "BigUInt.h"
+#include <vector>
+
+// 1xN 盤の局面数を、盤を左から1マスずつ読む有限オートマトンの動的計画法 (転送行列) で数える
+// 盤面を1つずつ作らないので、N が数百でも多倍長整数の足し算 O(N^2) 回で終わる
+//
+// - legal:     どの連にも呼吸点がある盤面 (手番は区別しない)
+// - reachable: m=1 で空の盤面から到達できる対局中の局面。m=1 では取った時点で終局するので、
+//              合法な盤面のうち 黒石数 - 白石数 が 0 (黒番) か 1 (白番) のものと一致する
+//              (合法な盤面から石を除いても合法なので、どの順に置いても途中で取りも自殺手も起きない)
+//              取って終わった直後の局面は含めない
+// - *_canonical: 左右反転で同じになるものを1つにまとめた数 (Burnside: (全体 + 左右対称なもの) / 2)
+class StateCounter {
+public:
+    struct Counts {
+        BigUInt legal;
+        BigUInt legal_canonical;
+        BigUInt reachable;
+        BigUInt reachable_canonical;
+        BigUInt black_to_move; // reachable のうち黒番 (石数が同じ)
+        BigUInt white_to_move; // reachable のうち白番 (黒が1つ多い)
+    };
+
+    Counts count(int n) const;
+    // N = from..to をまとめて数える (表を1回伸ばすだけなので count を N ごとに呼ぶより速い)
+    std::vector<Counts> count_range(int from, int to) const;
+
+    // 3^N 通りを全部調べて数える (小さい N の検算用)
+    static Counts brute_force(int n);
+
+private:
+    // 読み終わったところまでの状態。_LIB / _NOLIB は最後の連に左側で呼吸点があったか
+    enum State { WALL, EMPTY, BLACK_LIB, BLACK_NOLIB, WHITE_LIB, WHITE_NOLIB, NUM_STATES };
+
+    // 状態 s の次のマスが cell (0=空, 1=黒, 2=白) のときの状態。連が呼吸点なしで閉じるなら -1
+    static int next_state(int s, int cell);
+    static bool accepting(int s) { return s != BLACK_NOLIB && s != WHITE_NOLIB; }
+};
@@ -5,19 +5,43 @@ import glob
 import os
 import re
 
+# C++ の main_heatmap (winner_check-1Xn-faster) が書いた heatmap_*.csv から初期盤面の行だけを取り出す
+# 1行が1局面 (Cells にマスごとの g/r/x) なので、行ループなしで展開できる
+def load_native_heatmap(files):
+    df = pd.concat([pd.read_csv(f, dtype={'Board': str, 'Cells': str}) for f in files])
+    df = df[(df['Player'] == 1) & (df['BlackCap'] == 0) & (df['WhiteCap'] == 0) &
+            (df['Board'].str.strip('0') == '')]
+    df = df.drop_duplicates('N')
+    winner_data = df[['N', 'Winner']].to_dict('records')
+
+    # N ごとに長さが違うので、1文字ずつ縦に展開してから位置を振る (短い N に余分な列を作らない)
+    long = df[['N', 'Cells']].copy()
+    long['Type'] = long['Cells'].map(list)
+    long = long.explode('Type')
+    long = long[long['Type'].notna() & (long['Type'] != '')]
+    long['Position'] = long.groupby('N').cumcount()
+    long = long[['N', 'Position', 'Type']]
+    long['Value'] = long['Type'].map({'g': 1, 'r': -1, 'x': -2}).fillna(0).astype(int)
+    return long.to_dict('records'), winner_data
+
+
 def main():
     print("=== MiniGo 1xN Comparison Tool ===")
-    
-    # 1. CSVファイルの検索
-    csv_files = glob.glob("game_map_1x*.csv")
-    if not csv_files:
-        print("CSV file not found. Please run the C++ solver first.")
-        return
 
     data_list = []      # ヒートマップ用データ
     winner_data = []    # 勝者一覧用データ
-    
-    print(f"Found {len(csv_files)} files.")
+
+    # 1. CSVファイルの検索 (heatmap_*.csv があればそちらを使う。m=1 のファイルだけ)
+    native_files = [f for f in glob.glob("heatmap_*.csv") if "_m" not in os.path.basename(f)]
+    csv_files = [] if native_files else glob.glob("game_map_1x*.csv")
+    if native_files:
+        print(f"Found {len(native_files)} native heatmap files.")
+        data_list, winner_data = load_native_heatmap(native_files)
+    elif not csv_files:
+        print("CSV file not found. Please run the C++ solver first.")
+        return
+    else:
+        print(f"Found {len(csv_files)} files.")
 
     for file in csv_files:
         # ファイル名から N を抽出 (game_map_1x5.csv -> 5)
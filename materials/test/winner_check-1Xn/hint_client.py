@@ -0,0 +1,43 @@
+import socket
+
+# --- C++ ヒントサーバ (winner_check-1Xn-faster/main_server.cpp) のクライアント ---
+# 盤面は RawBoard と同じ (0:空, 1:黒, -1:白) のリスト/タプル
+class HintClient:
+    def __init__(self, path="/tmp/minigo_hint.sock"):
+        self.sock = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        self.sock.connect(path)
+        self.reader = self.sock.makefile("r")
+
+    def close(self):
+        self.sock.sendall(b"QUIT\n")
+        self.sock.close()
+
+    # 複数のリクエスト行をまとめて送り、応答をまとめて受け取る
+    def query_batch(self, lines):
+        self.sock.sendall(("".join(l + "\n" for l in lines)).encode())
+        results = []
+        for _ in lines:
+            resp = self.reader.readline().strip()
+            if not resp.startswith("OK "):
+                raise RuntimeError(resp)
+            results.append(resp[3:])
+        return results
+
+    @staticmethod
+    def _fmt(board, player):
+        return ",".join(str(v) for v in board) + " " + str(player)
+
+    # ヒント盤面 (例: "g,1,r,-1,x")
+    def hint(self, board, player):
+        return self.query_batch(["HINT " + self._fmt(board, player)])[0]
+
+    # 最善手の位置 (合法手が無ければ -1)
+    def best(self, board, player):
+        return int(self.query_batch(["BEST " + self._fmt(board, player)])[0])
+
+
+if __name__ == "__main__":
+    client = HintClient()
+    print(client.hint([0] * 5, 1))
+    print(client.best([0] * 5, 1))
+    client.close()
@@ -57,7 +57,8 @@ int main() {
         std::cout << "Skipping detailed Minimax summary for N > 100.\n";
     }
 
-    std::cout << "\nTotal nodes explored: " << solver.num_nodes() << "\n";
+    // 要約を出したときは打ち切った子も解いてあるので全局面の数、出さなかったときは打ち切った木の数
+    std::cout << "\nTotal nodes explored: " << solver.num_nodes() << (n <= 100 ? "" : " (pruned tree)") << "\n";
 
     // --- ファイルへの書き込み終了 ---
 
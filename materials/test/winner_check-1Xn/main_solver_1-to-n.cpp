@@ -43,7 +43,8 @@ int main() {
             std::cout << "Draw / Unknown";
         }
 
-        std::cout << " (Nodes: " << solver.num_nodes()
+        // 勝ちの子が見つかった所で打ち切った木のノード数 (全局面の数ではない)
+        std::cout << " (Nodes (pruned): " << solver.num_nodes()
                   << ", Time: " << elapsed_sec << " s)\n";
     }
 
@@ -0,0 +1,124 @@
+import ctypes
+import os
+import sys
+
+import numpy as np
+
+# --- C++ ソルバ (winner_check-1Xn-faster/MiniGoCAPI.h) を ctypes で直接呼ぶ ---
+# hint_client.py (ソケット経由) と違いサーバは要らない。盤面は RawBoard と同じ (0:空, 1:黒, -1:白)
+#
+# ライブラリのビルド (winner_check-1Xn-faster で):
+#   make libminigo.so
+# Windows は make minigo.dll LIB=minigo.dll
+
+_HERE = os.path.dirname(os.path.abspath(__file__))
+_DEFAULT_LIB = os.path.join(_HERE, "..", "winner_check-1Xn-faster",
+                            "minigo.dll" if sys.platform == "win32" else "libminigo.so")
+
+_i8p = ctypes.POINTER(ctypes.c_int8)
+
+
+def _as_int8(a):
+    # 型と並びが合っていればコピーしない
+    return np.ascontiguousarray(a, dtype=np.int8)
+
+
+class MiniGoNative:
+    def __init__(self, tt_bits=22, m=1, path=_DEFAULT_LIB):
+        lib = ctypes.CDLL(path)
+        lib.minigo_create.restype = ctypes.c_void_p
+        lib.minigo_create.argtypes = [ctypes.c_int]
+        lib.minigo_destroy.argtypes = [ctypes.c_void_p]
+        lib.minigo_set_capture_target.argtypes = [ctypes.c_void_p, ctypes.c_int]
+        lib.minigo_solve.argtypes = [ctypes.c_void_p, _i8p, ctypes.c_int, ctypes.c_int, ctypes.c_int, ctypes.c_int]
+        lib.minigo_hint.argtypes = [ctypes.c_void_p, _i8p, ctypes.c_int, ctypes.c_int, ctypes.c_int, ctypes.c_int,
+                                    ctypes.c_char_p]
+        lib.minigo_analyze.argtypes = [ctypes.c_void_p, ctypes.c_int, ctypes.c_int, ctypes.c_char_p, ctypes.c_int]
+        lib.minigo_solve_batch.argtypes = [ctypes.c_void_p, _i8p, ctypes.c_int, ctypes.c_int, _i8p, _i8p, _i8p]
+        self.lib = lib
+        self.engine = lib.minigo_create(tt_bits)
+        if not self.engine:
+            raise MemoryError("minigo_create failed (tt_bits=%d)" % tt_bits)
+        self.set_m(m)
+
+    def close(self):
+        if self.engine:
+            self.lib.minigo_destroy(self.engine)
+            self.engine = None
+
+    def __del__(self):
+        self.close()
+
+    def set_m(self, m):
+        if not self.lib.minigo_set_capture_target(self.engine, m):
+            raise ValueError("invalid m: %r" % m)
+        self.m = m
+
+    # 手番側から見た勝敗 (1=勝ち, -1=負け)
+    def solve(self, board, player, caps=(0, 0)):
+        b = _as_int8(board)
+        r = self.lib.minigo_solve(self.engine, b.ctypes.data_as(_i8p), len(b), player, caps[0], caps[1])
+        if r == 0:
+            raise ValueError("invalid position: %r" % (list(board),))
+        return r
+
+    # ヒント盤面 (hint_client.py と同じ形式 例: "g,1,r,-1,x")
+    def hint(self, board, player, caps=(0, 0)):
+        b = _as_int8(board)
+        out = ctypes.create_string_buffer(len(b))
+        if not self.lib.minigo_hint(self.engine, b.ctypes.data_as(_i8p), len(b), player, caps[0], caps[1], out):
+            raise ValueError("invalid position: %r" % (list(board),))
+        marks = out.raw.decode()
+        return ",".join(str(int(v)) if c == "." else c for v, c in zip(b, marks))
+
+    # 最善手の位置 (勝ち手があればそれ、無ければ最初の合法手、合法手が無ければ -1)
+    def best(self, board, player, caps=(0, 0)):
+        fallback = -1
+        for i, c in enumerate(self.hint(board, player, caps).split(",")):
+            if c == "g":
+                return i
+            if c == "r" and fallback < 0:
+                fallback = i
+        return fallback
+
+    # 空の 1xn の初手マップ (例: "rrgrr")
+    def analyze(self, n, m=None):
+        m = self.m if m is None else m
+        out = ctypes.create_string_buffer(n + 1)
+        if not self.lib.minigo_analyze(self.engine, n, m, out, n + 1):
+            raise ValueError("invalid n/m: %r %r" % (n, m))
+        self.m = m
+        return out.value.decode()
+
+    # boards: (count, n) の int8 配列。players: (count,)、caps: (count, 2) または None
+    # 戻り値 (count,) の int8 配列 (1 / -1、おかしい局面は 0)
+    def solve_batch(self, boards, players, caps=None, out=None):
+        b = _as_int8(boards)
+        if b.ndim != 2:
+            raise ValueError("boards must be (count, n): %r" % (b.shape,))
+        count, n = b.shape
+        # C 側は長さを確かめずに読み書きするので、ここで形をそろえておく
+        p = _as_int8(players)
+        if p.shape != (count,):
+            raise ValueError("players must be (%d,): %r" % (count, p.shape))
+        c = None if caps is None else _as_int8(caps)
+        if c is not None and c.shape != (count, 2):
+            raise ValueError("caps must be (%d, 2): %r" % (count, c.shape))
+        if out is None:
+            out = np.empty(count, dtype=np.int8)
+        elif not (isinstance(out, np.ndarray) and out.dtype == np.int8 and out.ndim == 1 and
+                  out.flags['C_CONTIGUOUS'] and out.flags['WRITEABLE'] and len(out) >= count):
+            raise ValueError("out must be a writable contiguous int8 array of length >= %d" % count)
+        self.lib.minigo_solve_batch(self.engine, b.ctypes.data_as(_i8p), count, n, p.ctypes.data_as(_i8p),
+                                    None if c is None else c.ctypes.data_as(_i8p), out.ctypes.data_as(_i8p))
+        return out
+
+
+if __name__ == "__main__":
+    engine = MiniGoNative()
+    print(engine.analyze(7))
+    print(engine.hint([0] * 5, 1))
+    print(engine.best([0] * 5, 1))
+    boards = np.array([[0, 0, 0, 0, 0], [1, 0, 0, -1, 0], [0, 1, -1, 0, 0]], dtype=np.int8)
+    print(engine.solve_batch(boards, np.array([1, 1, -1], dtype=np.int8)))
+    engine.close()